@@ -0,0 +1,397 @@
+#include "compile_time_json/compile_time_json.hpp"
+#include "compile_time_json/json_reader.hpp"
+#include "compile_time_json/lazy_json_view.hpp"
+#include "compile_time_json/stream_parser.hpp"
+#include "compile_time_json/tracked_json.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+// Prints one JSON object per line so the results can be collected and compared across releases:
+//   {"benchmark": "<group>/<subject>/<case>", "iterations": <n>, "ns_per_iteration": <t>}
+//   {"benchmark": "sizeof/<subject>", "bytes": <n>}
+
+template <typename Value>
+inline void do_not_optimize(const Value &value)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+}
+
+inline void clobber_memory()
+{
+#if defined(__GNUC__)
+    asm volatile("" : : : "memory");
+#endif
+}
+
+template <typename Operation>
+void run_benchmark(const std::string_view name, Operation &&operation)
+{
+    constexpr auto MinimumDuration = std::chrono::milliseconds(100);
+    constexpr std::size_t MaximumIterations = std::size_t{1} << 32;
+
+    for (std::size_t iterations = 1;; iterations *= 2)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t iteration = 0; iteration < iterations; iteration++)
+            operation();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        if (elapsed >= MinimumDuration || iterations >= MaximumIterations)
+        {
+            const auto nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count();
+            std::cout << R"({"benchmark": ")" << name << R"(", "iterations": )" << iterations << R"(, "ns_per_iteration": )" << nanoseconds / iterations << "}" << std::endl;
+            return;
+        }
+    }
+}
+
+void report_size(const std::string_view name, const std::size_t bytes)
+{
+    std::cout << R"({"benchmark": "sizeof/)" << name << R"(", "bytes": )" << bytes << "}" << std::endl;
+}
+
+constexpr FixedLengthString ConfigText = R"(
+    {
+        "name":  "service",
+        "region":  "eu-west",
+        "port":  8080,
+        "ratio":  0.75,
+        "enabled":  true,
+        "limits":  {"connections":  1024,  "timeout":  2.5,  "retries":  3},
+        "nested":  {"v":  1,  "a":  {"v":  2,  "a":  {"v":  3,  "a":  {"v":  4,  "a":  {"v":  5,  "a":  {"v":  6,  "a":  {"v":  7,  "a":  {"v":  8}}}}}}}}
+    }
+    )";
+
+constexpr FixedLengthString NumericConfigText = R"(
+    {
+        "port":  8080,
+        "ratio":  0.75,
+        "enabled":  true,
+        "limits":  {"connections":  1024,  "timeout":  2.5,  "retries":  3},
+        "nested":  {"v":  1,  "a":  {"v":  2,  "a":  {"v":  3,  "a":  {"v":  4,  "a":  {"v":  5,  "a":  {"v":  6,  "a":  {"v":  7,  "a":  {"v":  8}}}}}}}}
+    }
+    )";
+
+constexpr FixedLengthString RecordsText = R"(
+    {
+        "records":  [
+            {"id":  1,  "weight":  0.5},  {"id":  2,  "weight":  1.5},  {"id":  3,  "weight":  2.5},  {"id":  4,  "weight":  3.5},
+            {"id":  5,  "weight":  4.5},  {"id":  6,  "weight":  5.5},  {"id":  7,  "weight":  6.5},  {"id":  8,  "weight":  7.5},
+            {"id":  9,  "weight":  8.5},  {"id":  10,  "weight":  9.5},  {"id":  11,  "weight":  10.5},  {"id":  12,  "weight":  11.5},
+            {"id":  13,  "weight":  12.5},  {"id":  14,  "weight":  13.5},  {"id":  15,  "weight":  14.5},  {"id":  16,  "weight":  15.5}
+        ]
+    }
+    )";
+
+constexpr std::string_view ConfigString{ConfigText.string.data(), ConfigText.string.size() - 1};
+
+auto make_config()
+{
+    return operator"" _json<ConfigText>();
+}
+
+auto make_numeric_config()
+{
+    return operator"" _json<NumericConfigText>();
+}
+
+constexpr auto make_pooled_config()
+{
+    return operator"" _pooled_json<ConfigText>();
+}
+
+struct ConfigDocument
+{
+    static constexpr FixedLengthString Source = ConfigText;
+};
+
+using Config = decltype(make_config());
+using NumericConfig = decltype(make_numeric_config());
+using InternedConfig = InternedJsonType<ConfigDocument>;
+using PooledConfig = decltype(make_pooled_config());
+
+struct HandWrittenNested
+{
+    std::uintmax_t v;
+    struct A
+    {
+        std::uintmax_t v;
+        struct B
+        {
+            std::uintmax_t v;
+            struct C
+            {
+                std::uintmax_t v;
+                struct D
+                {
+                    std::uintmax_t v;
+                    struct E
+                    {
+                        std::uintmax_t v;
+                        struct F
+                        {
+                            std::uintmax_t v;
+                            struct G
+                            {
+                                std::uintmax_t v;
+                            } a;
+                        } a;
+                    } a;
+                } a;
+            } a;
+        } a;
+    } a;
+};
+
+struct HandWrittenNumericConfig
+{
+    std::uintmax_t port = 8080;
+    double ratio = 0.75;
+    bool enabled = true;
+    struct Limits
+    {
+        std::uintmax_t connections = 1024;
+        double timeout = 2.5;
+        std::uintmax_t retries = 3;
+    } limits;
+    HandWrittenNested nested{1, {2, {3, {4, {5, {6, {7, {8}}}}}}}};
+};
+
+struct HandWrittenConfig : HandWrittenNumericConfig
+{
+    std::string name = "service";
+    std::string region = "eu-west";
+};
+
+struct DynamicJson
+{
+    using Object = std::unordered_map<std::string, DynamicJson>;
+    using List = std::vector<DynamicJson>;
+
+    std::variant<std::monostate, bool, std::intmax_t, std::uintmax_t, double, std::string, Object, List> value;
+
+    const DynamicJson &operator[](const std::string &name) const
+    {
+        return std::get<Object>(value).at(name);
+    }
+};
+
+// Schema-less baseline decoder sharing the tokenizer of the schema decoder.
+DynamicJson read_dynamic_json(JsonReader &reader)
+{
+    reader.skip_white_space();
+    switch (reader.peek())
+    {
+    case '{':
+    {
+        DynamicJson::Object object;
+        reader.read_object([&](const std::string_view name) { object.emplace(std::string{name}, read_dynamic_json(reader)); });
+        return {std::move(object)};
+    }
+    case '[':
+    {
+        DynamicJson::List list;
+        reader.read_array([&](std::size_t) { list.push_back(read_dynamic_json(reader)); });
+        return {std::move(list)};
+    }
+    case '"':
+        return {unescape_json_string(reader.read_string_token())};
+    case 't':
+    case 'f':
+    {
+        Member<JsonValueType::BOOL> member;
+        reader.read_value(member);
+        return {member.value};
+    }
+    case 'n':
+    {
+        Member<JsonValueType::NULL_VALUE> member;
+        reader.read_value(member);
+        return {};
+    }
+    default:
+    {
+        const auto token = reader.read_number_token();
+        reader.position -= token.size();
+
+        if (token.find_first_of(".eE") != std::string_view::npos)
+        {
+            double number;
+            reader.read_number(number);
+            return {number};
+        }
+        if (token.front() == '-')
+        {
+            std::intmax_t number;
+            reader.read_number(number);
+            return {number};
+        }
+        std::uintmax_t number;
+        reader.read_number(number);
+        return {number};
+    }
+    }
+}
+
+DynamicJson read_dynamic_json(const std::string_view input)
+{
+    JsonReader reader{input};
+    return read_dynamic_json(reader);
+}
+
+void benchmark_access()
+{
+    auto json = make_config();
+    auto interned_json = construct_interned_json<ConfigDocument>();
+    HandWrittenConfig hand_written;
+    const auto dynamic_json = read_dynamic_json(ConfigString);
+    const std::string v = "v", a = "a", nested = "nested", ratio = "ratio";
+
+    do_not_optimize(json);
+    do_not_optimize(interned_json);
+    do_not_optimize(hand_written);
+
+    run_benchmark("access/json/depth_1", [&] { do_not_optimize(json["ratio"_member].value); clobber_memory(); });
+    run_benchmark("access/json/depth_2", [&] { do_not_optimize(json["nested"_member]["v"_member].value); clobber_memory(); });
+    run_benchmark("access/json/depth_4", [&] { do_not_optimize(json["nested"_member]["a"_member]["a"_member]["v"_member].value); clobber_memory(); });
+    run_benchmark("access/json/depth_8", [&] { do_not_optimize(json.get<"nested"_member>().get<"a"_member>().get<"a"_member>().get<"a"_member>().get<"a"_member>().get<"a"_member>().get<"a"_member>().get<"v"_member>().value); clobber_memory(); });
+    run_benchmark("access/json_path/depth_8", [&] { do_not_optimize(json["/nested/a/a/a/a/a/a/v"_path].value); clobber_memory(); });
+    run_benchmark("access/interned_json/depth_8", [&] { do_not_optimize(interned_json["/nested/a/a/a/a/a/a/v"_path].value); clobber_memory(); });
+
+    run_benchmark("access/hand_written/depth_1", [&] { do_not_optimize(hand_written.ratio); clobber_memory(); });
+    run_benchmark("access/hand_written/depth_2", [&] { do_not_optimize(hand_written.nested.v); clobber_memory(); });
+    run_benchmark("access/hand_written/depth_4", [&] { do_not_optimize(hand_written.nested.a.a.v); clobber_memory(); });
+    run_benchmark("access/hand_written/depth_8", [&] { do_not_optimize(hand_written.nested.a.a.a.a.a.a.v); clobber_memory(); });
+
+    run_benchmark("access/unordered_map/depth_1", [&] { do_not_optimize(dynamic_json[ratio].value); });
+    run_benchmark("access/unordered_map/depth_2", [&] { do_not_optimize(dynamic_json[nested][v].value); });
+    run_benchmark("access/unordered_map/depth_4", [&] { do_not_optimize(dynamic_json[nested][a][a][v].value); });
+    run_benchmark("access/unordered_map/depth_8", [&] { do_not_optimize(dynamic_json[nested][a][a][a][a][a][a][v].value); });
+}
+
+void benchmark_tracking()
+{
+    auto json = make_config();
+    TrackedJson<decltype(json)> tracked_json{json};
+
+    run_benchmark("write/json/depth_8", [&] { json["/nested/a/a/a/a/a/a/v"_path].value++; clobber_memory(); });
+    run_benchmark("write/tracked_json/depth_8", [&] { tracked_json["/nested/a/a/a/a/a/a/v"_path].value++; clobber_memory(); });
+    run_benchmark("write/tracked_json/for_each_changed", [&] {
+        std::size_t changed_count = 0;
+        tracked_json.for_each_changed([&](const JsonLeafDescriptor &) { changed_count++; });
+        do_not_optimize(changed_count);
+    });
+}
+
+void benchmark_records()
+{
+    auto json = operator"" _json<RecordsText>();
+    do_not_optimize(json);
+
+    run_benchmark("records/uniform_array/sum_16", [&] {
+        double sum = 0;
+        for (const auto &record : json["records"_member])
+            sum += record["weight"_member].value;
+        do_not_optimize(sum);
+        clobber_memory();
+    });
+}
+
+void benchmark_construction()
+{
+    run_benchmark("construct/json/with_strings", [] { auto json = make_config(); do_not_optimize(json); });
+    run_benchmark("construct/interned_json/with_strings", [] { auto json = construct_interned_json<ConfigDocument>(); do_not_optimize(json); });
+    run_benchmark("construct/pooled_json/with_strings", [] { auto json = make_pooled_config(); do_not_optimize(json); });
+    run_benchmark("construct/json/numeric", [] { auto json = make_numeric_config(); do_not_optimize(json); });
+    run_benchmark("construct/hand_written/with_strings", [] { HandWrittenConfig hand_written; do_not_optimize(hand_written); });
+    run_benchmark("construct/hand_written/numeric", [] { HandWrittenNumericConfig hand_written; do_not_optimize(hand_written); });
+}
+
+void benchmark_copy()
+{
+    const auto json = make_config();
+    const auto numeric_json = make_numeric_config();
+    const auto pooled_json = make_pooled_config();
+    const HandWrittenConfig hand_written;
+    const HandWrittenNumericConfig numeric_hand_written;
+    const auto dynamic_json = read_dynamic_json(ConfigString);
+
+    run_benchmark("copy/json/with_strings", [&] { auto copy = json; do_not_optimize(copy); });
+    run_benchmark("copy/pooled_json/with_strings", [&] { auto copy = pooled_json; do_not_optimize(copy); });
+    run_benchmark("copy/json/numeric", [&] { auto copy = numeric_json; do_not_optimize(copy); });
+    run_benchmark("copy/hand_written/with_strings", [&] { auto copy = hand_written; do_not_optimize(copy); });
+    run_benchmark("copy/hand_written/numeric", [&] { auto copy = numeric_hand_written; do_not_optimize(copy); });
+    run_benchmark("copy/unordered_map/with_strings", [&] { auto copy = dynamic_json; do_not_optimize(copy); });
+
+    auto json_target = json;
+    auto numeric_json_target = numeric_json;
+    auto hand_written_target = hand_written;
+    auto numeric_hand_written_target = numeric_hand_written;
+    run_benchmark("assign/json/with_strings", [&] { json_target = json; do_not_optimize(json_target); });
+    run_benchmark("assign/json/numeric", [&] { numeric_json_target = numeric_json; do_not_optimize(numeric_json_target); });
+    run_benchmark("assign/hand_written/with_strings", [&] { hand_written_target = hand_written; do_not_optimize(hand_written_target); });
+    run_benchmark("assign/hand_written/numeric", [&] { numeric_hand_written_target = numeric_hand_written; do_not_optimize(numeric_hand_written_target); });
+}
+
+void benchmark_parse()
+{
+    const std::string_view input = ConfigString;
+
+    run_benchmark("parse/json_reader/full", [&] {
+        Config json;
+        JsonReader reader{input};
+        reader.read_value(json);
+        do_not_optimize(json);
+    });
+    run_benchmark("parse/stream_parser/chunks_of_16", [&] {
+        Config json;
+        JsonStreamParser parser{json};
+        for (std::size_t chunk_begin = 0; !parser.is_record_ready();)
+            chunk_begin += parser.feed(std::span{input}.subspan(chunk_begin, std::min<std::size_t>(16, input.size() - chunk_begin)));
+        do_not_optimize(json);
+    });
+    std::pmr::monotonic_buffer_resource resource;
+    JsonStringPool string_pool{&resource};
+    run_benchmark("parse/json_reader/pooled_strings", [&] {
+        PooledConfig json;
+        JsonReader reader{input, 0, &string_pool};
+        reader.read_value(json);
+        do_not_optimize(json);
+    });
+    run_benchmark("parse/lazy_json_view/one_member", [&] {
+        const LazyJsonView<Config> view{input};
+        do_not_optimize(view["enabled"_member].value);
+    });
+    run_benchmark("parse/unordered_map/full", [&] { do_not_optimize(read_dynamic_json(input)); });
+}
+
+void report_sizes()
+{
+    report_size("json/with_strings", sizeof(Config));
+    report_size("json/numeric", sizeof(NumericConfig));
+    report_size("interned_json/with_strings", sizeof(InternedConfig));
+    report_size("pooled_json/with_strings", sizeof(PooledConfig));
+    report_size("hand_written/with_strings", sizeof(HandWrittenConfig));
+    report_size("hand_written/numeric", sizeof(HandWrittenNumericConfig));
+}
+
+int main()
+{
+    report_sizes();
+    benchmark_access();
+    benchmark_records();
+    benchmark_tracking();
+    benchmark_construction();
+    benchmark_copy();
+    benchmark_parse();
+}
@@ -1,4 +1,7 @@
+#pragma once
+
 #include <cstddef>
+#include <cstdint>
 #include <ranges>
 #include <algorithm>
 #include <array>
@@ -6,9 +9,13 @@
 #include <span>
 #include <iostream>
 #include <charconv>
+#include <functional>
+#include <string>
+#include <string_view>
 #include <type_traits>
 #include <limits>
-#include <ranges>
+#include <tuple>
+#include <utility>
 
 template <std::size_t... Indices>
 struct EnumeratorImpl
@@ -57,6 +64,180 @@ enum struct JsonValueType
     NULL_VALUE,
 };
 
+// Tokens a parser would have accepted where it failed, alternatives that failed at the same position add theirs to the set.
+enum struct JsonExpectedTokens : std::uint16_t
+{
+    NONE = 0,
+    VALUE = 1 << 0,
+    MEMBER_NAME = 1 << 1,
+    COLON = 1 << 2,
+    COMMA = 1 << 3,
+    OBJECT_BEGIN = 1 << 4,
+    OBJECT_END = 1 << 5,
+    ARRAY_BEGIN = 1 << 6,
+    ARRAY_END = 1 << 7,
+    QUOTE = 1 << 8,
+    DIGIT = 1 << 9,
+    DOT = 1 << 10,
+    LITERAL = 1 << 11,
+    END_OF_INPUT = 1 << 12,
+};
+
+constexpr JsonExpectedTokens operator|(const JsonExpectedTokens left, const JsonExpectedTokens right) noexcept
+{
+    return static_cast<JsonExpectedTokens>(static_cast<std::uint16_t>(left) | static_cast<std::uint16_t>(right));
+}
+
+constexpr bool has_json_expected_token(const JsonExpectedTokens expected, const JsonExpectedTokens token) noexcept
+{
+    return static_cast<std::uint16_t>(expected) & static_cast<std::uint16_t>(token);
+}
+
+constexpr JsonExpectedTokens json_expected_token(const char c) noexcept
+{
+    switch (c)
+    {
+    case '{':
+        return JsonExpectedTokens::OBJECT_BEGIN;
+    case '}':
+        return JsonExpectedTokens::OBJECT_END;
+    case '[':
+        return JsonExpectedTokens::ARRAY_BEGIN;
+    case ']':
+        return JsonExpectedTokens::ARRAY_END;
+    case ',':
+        return JsonExpectedTokens::COMMA;
+    case ':':
+        return JsonExpectedTokens::COLON;
+    case '"':
+        return JsonExpectedTokens::QUOTE;
+    case '.':
+        return JsonExpectedTokens::DOT;
+    case '\0':
+        return JsonExpectedTokens::END_OF_INPUT;
+    default:
+        return (c <= 'z' & c >= 'a') ? JsonExpectedTokens::LITERAL : JsonExpectedTokens::NONE;
+    }
+}
+
+// Lists the tokens of the set for error messages, like "',' or '}'".
+constexpr std::string describe_json_expected_tokens(const JsonExpectedTokens expected)
+{
+    constexpr std::array<std::pair<JsonExpectedTokens, std::string_view>, 13> Descriptions{{
+        {JsonExpectedTokens::VALUE, "a value"},
+        {JsonExpectedTokens::MEMBER_NAME, "a member name"},
+        {JsonExpectedTokens::COLON, "':'"},
+        {JsonExpectedTokens::COMMA, "','"},
+        {JsonExpectedTokens::OBJECT_BEGIN, "'{'"},
+        {JsonExpectedTokens::OBJECT_END, "'}'"},
+        {JsonExpectedTokens::ARRAY_BEGIN, "'['"},
+        {JsonExpectedTokens::ARRAY_END, "']'"},
+        {JsonExpectedTokens::QUOTE, "'\"'"},
+        {JsonExpectedTokens::DIGIT, "a digit"},
+        {JsonExpectedTokens::DOT, "'.'"},
+        {JsonExpectedTokens::LITERAL, "true, false or null"},
+        {JsonExpectedTokens::END_OF_INPUT, "the end of the input"},
+    }};
+
+    const auto token_count = std::ranges::count_if(Descriptions, [&](const auto &description) { return has_json_expected_token(expected, description.first); });
+
+    std::string description_string;
+    std::ptrdiff_t token_index = 0;
+    for (const auto &[token, description] : Descriptions)
+    {
+        if (!has_json_expected_token(expected, token))
+            continue;
+
+        if (token_index)
+            description_string.append(token_index + 1 == token_count ? " or " : ", ");
+        description_string.append(description);
+        token_index++;
+    }
+    return description_string;
+}
+
+// Failure of one of the parsers. char_index is the offset of the offending character in the input, line and column start at one.
+struct JsonParseFailure
+{
+    std::string_view error;
+    std::size_t char_index{0};
+    std::size_t line{1};
+    std::size_t column{1};
+    JsonExpectedTokens expected{JsonExpectedTokens::NONE};
+};
+
+constexpr JsonParseFailure locate_json_parse_failure(const std::string_view input, const std::string_view error, const std::size_t char_index, const JsonExpectedTokens expected = JsonExpectedTokens::NONE)
+{
+    const auto preceding_input = input.substr(0, char_index);
+    const auto line_end = preceding_input.rfind('\n');
+    const auto column = line_end == std::string_view::npos ? char_index + 1 : char_index - line_end;
+    return {error, char_index, static_cast<std::size_t>(std::ranges::count(preceding_input, '\n')) + 1, column, expected};
+}
+
+// Instantiated for documents that fail to parse at compile time, so the compiler reports the position and the reason of the failure
+// in the template arguments.
+template <std::size_t Line, std::size_t Column, std::size_t CharIndex, FixedLengthString Error, FixedLengthString Expected>
+struct JsonSyntaxError
+{
+    static_assert(Line == 0, "The JSON document has a syntax error, its line, column, offset, reason and expected tokens are the template arguments of JsonSyntaxError.");
+};
+
+constexpr std::string unescape_json_string(const std::string_view value_string)
+{
+    std::string string_value;
+    string_value.reserve(value_string.size());
+
+    bool is_in_escape_state = false;
+    for (const char c : value_string)
+    {
+        if (is_in_escape_state)
+        {
+            switch (c)
+            {
+            case 'n':
+                string_value.push_back('\n');
+                break;
+            case 'r':
+                string_value.push_back('\r');
+                break;
+            case 'b':
+                string_value.push_back('\b');
+                break;
+            case 'f':
+                string_value.push_back('\f');
+                break;
+            case 't':
+                string_value.push_back('\t');
+                break;
+            case '"':
+                string_value.push_back('"');
+                break;
+            case '\\':
+                string_value.push_back('\\');
+                break;
+            default:
+                string_value.push_back('\\');
+                string_value.push_back(c);
+            }
+            is_in_escape_state = false;
+        }
+        else
+        {
+            if (c == '\\')
+            {
+                is_in_escape_state = true;
+                continue;
+            }
+
+            string_value.push_back(c);
+        }
+    }
+    return string_value;
+}
+
+template <FixedLengthString String>
+struct JsonStringLiteralPool;
+
 template <FixedLengthString String>
 struct ParseContext
 {
@@ -64,7 +245,8 @@ struct ParseContext
     {
     };
 
-    static constexpr std::size_t EstimatedMaxResultSize = String.string.size() / 6;
+    // Every value other than the root follows a ':', a '[' or a ',', so counting them bounds the number of values in the input.
+    static constexpr std::size_t EstimatedMaxResultSize = std::ranges::count_if(String.string, [](const char c) { return c == ':' | c == '[' | c == ','; }) + 1;
     struct StringView
     {
         std::size_t begin{};
@@ -181,7 +363,7 @@ struct ParseContext
                     fraction_value = (fraction_value + digit) / 10.0;
                 }
 
-                double_value = whole_value + fraction_value;
+                double_value = sign * (whole_value + fraction_value);
             }
             else
                 std::from_chars(value_string.begin(), value_string.end(), double_value);
@@ -190,65 +372,33 @@ struct ParseContext
 
         constexpr auto get_string() const // TODO: wait for string to become constexpr in implementation
         {
-            const std::string_view value_string{value};
-            std::string string_value;
-            string_value.reserve(value_string.size());
-
-            bool is_in_escape_state = false;
-            for (const char c : value_string)
-            {
-                if (is_in_escape_state)
-                {
-                    switch (c)
-                    {
-                    case 'n':
-                        string_value.push_back('\n');
-                        break;
-                    case 'r':
-                        string_value.push_back('\r');
-                        break;
-                    case 'b':
-                        string_value.push_back('\b');
-                        break;
-                    case 'f':
-                        string_value.push_back('\f');
-                        break;
-                    case 't':
-                        string_value.push_back('\t');
-                        break;
-                    case '"':
-                        string_value.push_back('"');
-                        break;
-                    case '\\':
-                        string_value.push_back('\\');
-                        break;
-                    default:
-                        string_value.push_back('\\');
-                        string_value.push_back(c);
-                    }
-                    is_in_escape_state = false;
-                }
-                else
-                {
-                    if (c == '\\')
-                    {
-                        is_in_escape_state = true;
-                        continue;
-                    }
+            return unescape_json_string(std::string_view{value});
+        }
 
-                    string_value.push_back(c);
-                }
-            }
-            return string_value;
+        constexpr std::string_view get_pooled_string() const
+        {
+            return JsonStringLiteralPool<String>::find(value.begin);
         }
     };
 
+    // Hard failures happen after a parser committed to its input, like a missing ':' after a member name, no other alternative can
+    // match there so the combinators stop backtracking.
+    struct FailureResult
+    {
+        std::string_view error;
+        std::size_t char_index;
+        JsonExpectedTokens expected{JsonExpectedTokens::NONE};
+        bool is_hard{false};
+    };
+
     struct FinalJsonResultContext
     {
         std::span<JsonMember> children;
         std::size_t &children_count;
         std::span<JsonMember> children_object_values;
         std::size_t &children_object_values_length;
+        // The failure furthest into the input, it is the one reported when the whole parse fails.
+        FailureResult &furthest_failure;
     };
 
     struct SuccessResult
@@ -256,16 +406,30 @@ struct ParseContext
         std::string_view remaining;
     };
 
-    struct FailureResult
-    {
-        std::string_view error;
-        std::size_t char_index;
-    };
-
     using ResultType = std::variant<SuccessResult, FailureResult>;
 
     using ParserType = std::function<ResultType(const std::string_view &input, const FinalJsonResultContext final_result_context)>;
 
+    static constexpr std::size_t get_char_index(const std::string_view &input) noexcept
+    {
+        return input.data() - String.string.data();
+    }
+
+    static constexpr void record_failure(const FailureResult &failure, const FinalJsonResultContext final_result_context) noexcept
+    {
+        auto &furthest_failure = final_result_context.furthest_failure;
+        if (furthest_failure.expected == JsonExpectedTokens::NONE | failure.char_index > furthest_failure.char_index)
+            furthest_failure = failure;
+        else if (failure.char_index == furthest_failure.char_index)
+            furthest_failure.expected = furthest_failure.expected | failure.expected;
+    }
+
+    static constexpr bool is_hard_failure(const ResultType &result) noexcept
+    {
+        const auto *const failure_result = std::get_if<FailureResult>(&result);
+        return failure_result && failure_result->is_hard;
+    }
+
     static constexpr bool is_white_space(const char c)
     {
         return c == ' ' | c == '\t' | c == '\n';
@@ -291,6 +455,8 @@ struct ParseContext
                 const auto result = parser(remaining, final_result_context);
                 if (const auto *const success_result = std::get_if<SuccessResult>(&result))
                     remaining = success_result->remaining;
+                else if (is_hard_failure(result))
+                    return result;
                 else
                     return ResultType{SuccessResult{remaining}};
             }
@@ -305,6 +471,8 @@ struct ParseContext
             const auto result = parser(remaining, final_result_context);
             if (const auto *const success_result = std::get_if<SuccessResult>(&result))
                 return result;
+            else if (is_hard_failure(result))
+                return result;
             else
                 return ResultType{SuccessResult{remaining}};
         };
@@ -334,12 +502,29 @@ struct ParseContext
         };
     }
 
+    // Like concat_parsers, but once the head parser matched every failure of the tail parsers is hard.
+    template <typename HeadParser, typename... TailParsers>
+    static constexpr auto committed_parsers(HeadParser &&head_parser, TailParsers &&... tail_parsers)
+    {
+        return [head_parser, tail_parsers...](const std::string_view &input, const FinalJsonResultContext final_result_context) {
+            const auto head_result = head_parser(input, final_result_context);
+            const auto *const success_result = std::get_if<SuccessResult>(&head_result);
+            if (!success_result)
+                return head_result;
+
+            auto tail_result = fold_execute_parsers(success_result->remaining, final_result_context, tail_parsers...);
+            if (auto *const failure_result = std::get_if<FailureResult>(&tail_result))
+                failure_result->is_hard = true;
+            return tail_result;
+        };
+    }
+
     template <typename HeadParser, typename... TailParsers>
     static constexpr ResultType execute_until_parsers(const std::string_view &input, const FinalJsonResultContext final_result_context, HeadParser &&head_parser, TailParsers &&... tail_parsers)
     {
         const auto head_result = head_parser(input, final_result_context);
 
-        if (const auto *const success_result = std::get_if<SuccessResult>(&head_result))
+        if (std::holds_alternative<SuccessResult>(head_result) | is_hard_failure(head_result))
             return head_result;
         else
         {
@@ -358,20 +543,29 @@ struct ParseContext
         };
     }
 
+    // Failures are recorded with the token the parser expected, parsers that are only optional filler like white space expect none.
     template <typename Predicate>
-    static constexpr auto single_character_predicate_parser(Predicate &&predicate)
+    static constexpr auto single_character_predicate_parser(Predicate &&predicate, const JsonExpectedTokens expected = JsonExpectedTokens::NONE)
     {
-        return [predicate](const std::string_view &input, const FinalJsonResultContext final_result_context) {
+        return [predicate, expected](const std::string_view &input, const FinalJsonResultContext final_result_context) {
             if (input.size() && predicate(input.front()))
                 return ResultType{SuccessResult{input.substr(1)}};
-            else
-                return ResultType{FailureResult{"The character failed the expected predicate.", 0}};
+
+            const FailureResult failure{input.empty() || input.front() == '\0' ? "Unexpected end of the input." : "Unexpected character.", get_char_index(input), expected};
+            if (expected != JsonExpectedTokens::NONE)
+                record_failure(failure, final_result_context);
+            return ResultType{failure};
         };
     }
 
+    static constexpr auto single_character_parser(const char c, const JsonExpectedTokens expected)
+    {
+        return single_character_predicate_parser([c](const char input) { return c == input; }, expected);
+    }
+
     static constexpr auto single_character_parser(const char c)
     {
-        return single_character_predicate_parser([c](const char input) { return c == input; });
+        return single_character_parser(c, json_expected_token(c));
     }
 
     static constexpr auto ZeroOrManySpaces = zero_or_many(single_character_predicate_parser(is_white_space));
@@ -379,14 +573,16 @@ struct ParseContext
     static constexpr auto ParseComma = single_character_parser(',');
     static constexpr auto ParseMinus = single_character_parser('-');
     static constexpr auto ParseDot = single_character_parser('.');
-    static constexpr auto ParseUnsignedInteger = concat_parsers(single_character_predicate_parser(is_digit), zero_or_many(single_character_predicate_parser(is_digit)));
+    static constexpr auto ParseDigit = single_character_predicate_parser(is_digit, JsonExpectedTokens::DIGIT);
+    static constexpr auto ParseUnsignedInteger = concat_parsers(ParseDigit, zero_or_many(ParseDigit));
 
     static constexpr ResultType parse_value(const std::string_view &input, const FinalJsonResultContext final_result_context)
     {
         auto &current_member = final_result_context.children[final_result_context.children_count];
+        const auto furthest_failure_before_value = final_result_context.furthest_failure;
 
         {
-            constexpr auto ParseNull = concat_parsers(
+            constexpr auto ParseNull = committed_parsers(
                 single_character_parser('n'),
                 single_character_parser('u'),
                 single_character_parser('l'),
@@ -398,16 +594,18 @@ struct ParseContext
                 current_member.type = JsonValueType::NULL_VALUE;
                 return parse_null_result;
             }
+            else if (is_hard_failure(parse_null_result))
+                return parse_null_result;
         }
 
         {
             constexpr auto ParseBool = any_of_parsers(
-                concat_parsers(
+                committed_parsers(
                     single_character_parser('t'),
                     single_character_parser('r'),
                     single_character_parser('u'),
                     single_character_parser('e')),
-                concat_parsers(
+                committed_parsers(
                     single_character_parser('f'),
                     single_character_parser('a'),
                     single_character_parser('l'),
@@ -421,13 +619,15 @@ struct ParseContext
                 current_member.value = StringView{std::string_view(input.data(), success_result->remaining.data())};
                 return parse_bool_result;
             }
+            else if (is_hard_failure(parse_bool_result))
+                return parse_bool_result;
         }
 
         {
             current_member.object_start = final_result_context.children_object_values_length;
             std::array<JsonMember, EstimatedMaxResultSize> children_object_values;
             std::size_t children_object_values_length = 0;
-            const FinalJsonResultContext new_value_parse_result_context{final_result_context.children_object_values, final_result_context.children_object_values_length, children_object_values, children_object_values_length};
+            const FinalJsonResultContext new_value_parse_result_context{final_result_context.children_object_values, final_result_context.children_object_values_length, children_object_values, children_object_values_length, final_result_context.furthest_failure};
             const auto parse_json_result = parse_json_impl(input, new_value_parse_result_context);
 
             if (const auto *const success_result = std::get_if<SuccessResult>(&parse_json_result))
@@ -439,14 +639,16 @@ struct ParseContext
                 final_result_context.children_object_values_length += children_object_values_length;
                 return parse_json_result;
             }
+            else if (is_hard_failure(parse_json_result))
+                return parse_json_result;
         }
 
         {
-            constexpr auto ParseString = concat_parsers(
+            constexpr auto ParseString = committed_parsers(
                 ParseQuote,
                 zero_or_many(any_of_parsers(
                     concat_parsers(single_character_parser('\\'), any_of_parsers(single_character_parser('\\'), ParseQuote)),
-                    single_character_predicate_parser([](const char c) { return (c != '\t') & (c != '\n') & (c != '\b') & (c != '\f') & (c != '\r') & (c != '"'); }))),
+                    single_character_predicate_parser([](const char c) { return (c != '\t') & (c != '\n') & (c != '\b') & (c != '\f') & (c != '\r') & (c != '"') & (c != '\0'); }))),
                 ParseQuote);
 
             const auto parse_string_result = ParseString(input, final_result_context);
@@ -457,6 +659,8 @@ struct ParseContext
                 current_member.value = StringView{std::string_view(std::next(input.data()), std::prev(success_result->remaining.data()))};
                 return parse_string_result;
             }
+            else if (is_hard_failure(parse_string_result))
+                return parse_string_result;
         }
 
         {
@@ -467,7 +671,7 @@ struct ParseContext
 
                 return parse_value_result;
             };
-            constexpr auto ParseArray = concat_parsers(
+            constexpr auto ParseArray = committed_parsers(
                 single_character_parser('['),
                 ZeroOrManySpaces,
                 at_most_one(
@@ -481,7 +685,7 @@ struct ParseContext
             current_member.object_start = final_result_context.children_object_values_length;
             std::array<JsonMember, EstimatedMaxResultSize> children_object_values;
             std::size_t children_object_values_length = 0;
-            const FinalJsonResultContext new_value_parse_result_context{final_result_context.children_object_values, final_result_context.children_object_values_length, children_object_values, children_object_values_length};
+            const FinalJsonResultContext new_value_parse_result_context{final_result_context.children_object_values, final_result_context.children_object_values_length, children_object_values, children_object_values_length, final_result_context.furthest_failure};
             const auto parse_array_result = ParseArray(input, new_value_parse_result_context);
 
             if (const auto *const success_result = std::get_if<SuccessResult>(&parse_array_result))
@@ -493,6 +697,8 @@ struct ParseContext
                 final_result_context.children_object_values_length += children_object_values_length;
                 return parse_array_result;
             }
+            else if (is_hard_failure(parse_array_result))
+                return parse_array_result;
         }
 
         {
@@ -510,7 +716,7 @@ struct ParseContext
 
         {
             // TODO: Improve parsing to include scientific notation and lots more
-            constexpr auto ParseFloatingPoint = concat_parsers(at_most_one(ParseMinus), ParseUnsignedInteger, ParseDot, zero_or_many(single_character_predicate_parser(is_digit)));
+            constexpr auto ParseFloatingPoint = concat_parsers(at_most_one(ParseMinus), ParseUnsignedInteger, ParseDot, zero_or_many(ParseDigit));
 
             const auto parse_floating_point_result = ParseFloatingPoint(input, final_result_context);
 
@@ -545,13 +751,20 @@ struct ParseContext
             }
         }
 
-        return ResultType{FailureResult{"Expected a value but couldn't find any.", 0}};
+        // If no alternative got past the first character, the tokens they expected are replaced by the value as a whole.
+        const FailureResult failure{"Expected a value but couldn't find any.", get_char_index(input), JsonExpectedTokens::VALUE};
+        if (final_result_context.furthest_failure.char_index <= failure.char_index)
+        {
+            final_result_context.furthest_failure = furthest_failure_before_value;
+            record_failure(failure, final_result_context);
+        }
+        return ResultType{failure};
     }
 
     static constexpr ResultType parse_member(const std::string_view &input, const FinalJsonResultContext final_result_context)
     {
-        constexpr auto IdentifierParser = concat_parsers(single_character_predicate_parser(is_alphabet), zero_or_many(single_character_predicate_parser([](const char c) { return is_alphabet(c) | is_digit(c) | c == '_'; })));
-        constexpr auto ParseName = concat_parsers(ParseQuote, IdentifierParser, ParseQuote);
+        constexpr auto IdentifierParser = concat_parsers(single_character_predicate_parser(is_alphabet, JsonExpectedTokens::MEMBER_NAME), zero_or_many(single_character_predicate_parser([](const char c) { return is_alphabet(c) | is_digit(c) | c == '_'; })));
+        constexpr auto ParseName = committed_parsers(single_character_parser('"', JsonExpectedTokens::MEMBER_NAME), IdentifierParser, ParseQuote);
 
         const auto parse_name_result = ParseName(input, final_result_context);
         if (const auto *const failure_result = std::get_if<FailureResult>(&parse_name_result))
@@ -563,11 +776,11 @@ struct ParseContext
         constexpr auto ParseUntilValue = concat_parsers(ZeroOrManySpaces, single_character_parser(':'), ZeroOrManySpaces);
         const auto parse_until_value_result = ParseUntilValue(parse_name_remaining, final_result_context);
         if (const auto *const failure_result = std::get_if<FailureResult>(&parse_until_value_result))
-            return parse_until_value_result;
+            return ResultType{FailureResult{failure_result->error, failure_result->char_index, failure_result->expected, true}};
 
         const auto parse_value_result = parse_value(std::get<SuccessResult>(parse_until_value_result).remaining, final_result_context);
         if (const auto *const failure_result = std::get_if<FailureResult>(&parse_value_result))
-            return parse_value_result;
+            return ResultType{FailureResult{failure_result->error, failure_result->char_index, failure_result->expected, true}};
 
         final_result_context.children_count++;
         return parse_value_result;
@@ -576,11 +789,22 @@ struct ParseContext
     static constexpr ResultType parse_json_impl(const std::string_view &input, const FinalJsonResultContext final_result_context)
     {
         return concat_parsers(ZeroOrManySpaces,
-                              single_character_parser('{'), ZeroOrManySpaces,
-                              at_most_one(concat_parsers(parse_member, ZeroOrManySpaces,
-                                                         zero_or_many(concat_parsers(ParseComma, ZeroOrManySpaces, parse_member, ZeroOrManySpaces)),
-                                                         at_most_one(concat_parsers(ParseComma, ZeroOrManySpaces)))),
-                              single_character_parser('}'))(input, final_result_context);
+                              committed_parsers(single_character_parser('{'), ZeroOrManySpaces,
+                                                at_most_one(concat_parsers(parse_member, ZeroOrManySpaces,
+                                                                           zero_or_many(concat_parsers(ParseComma, ZeroOrManySpaces, parse_member, ZeroOrManySpaces)),
+                                                                           at_most_one(concat_parsers(ParseComma, ZeroOrManySpaces)))),
+                                                single_character_parser('}')))(input, final_result_context);
+    }
+
+    static constexpr ResultType parse_document(const std::string_view &input, const FinalJsonResultContext final_result_context)
+    {
+        constexpr auto ParseEnd = single_character_predicate_parser([](const char c) { return c == '\0'; }, JsonExpectedTokens::END_OF_INPUT);
+        const auto parse_json_result = concat_parsers(parse_json_impl, ZeroOrManySpaces)(input, final_result_context);
+        const auto *const success_result = std::get_if<SuccessResult>(&parse_json_result);
+        if (!success_result || success_result->remaining.empty())
+            return parse_json_result;
+
+        return ParseEnd(success_result->remaining, final_result_context);
     }
 
     struct JsonStructure
@@ -590,31 +814,221 @@ struct ParseContext
         std::size_t children_count = 0;
     };
 
-    static constexpr JsonStructure parse_json()
+    struct ParseOutcome
+    {
+        JsonStructure structure;
+        bool is_success;
+        FailureResult failure;
+    };
+
+    static constexpr ParseOutcome parse()
     {
         std::array<JsonMember, EstimatedMaxResultSize> children;
         std::size_t children_count = 0;
         std::array<JsonMember, EstimatedMaxResultSize> children_object_values;
         std::size_t children_object_values_length = 0;
+        FailureResult furthest_failure{};
 
-        FinalJsonResultContext result_context{children, children_count, children_object_values, children_object_values_length};
-        const auto parse_result = parse_json_impl(std::string_view(StringView{WholeInputString{}}), result_context);
+        FinalJsonResultContext result_context{children, children_count, children_object_values, children_object_values_length, furthest_failure};
+        const auto parse_result = parse_document(std::string_view(StringView{WholeInputString{}}), result_context);
 
         std::ranges::copy(std::span(children_object_values.begin(), children_object_values_length), children.begin() + children_count);
 
-        if (const auto *failure_result = std::get_if<FailureResult>(&parse_result))
-            throw *failure_result;
+        return {{children, children_count}, std::holds_alternative<SuccessResult>(parse_result), furthest_failure};
+    }
+
+    static constexpr ParseOutcome Outcome = parse();
+
+    // Position and reason of the failure, line and column are counted in the document.
+    static constexpr JsonParseFailure get_failure()
+    {
+        return locate_json_parse_failure(std::string_view{String.string.data(), String.string.size()}, Outcome.failure.error, Outcome.failure.char_index, Outcome.failure.expected);
+    }
+
+    static constexpr JsonStructure parse_json()
+    {
+        if constexpr (!Outcome.is_success)
+        {
+            constexpr auto Failure = get_failure();
+            constexpr auto Expected = [] {
+                constexpr auto ExpectedSize = describe_json_expected_tokens(Failure.expected).size() + 1;
+                std::array<char, ExpectedSize> expected{};
+                std::ranges::copy(describe_json_expected_tokens(Failure.expected), expected.begin());
+                return FixedLengthString<ExpectedSize>(expected.data());
+            }();
+
+            [[maybe_unused]] const JsonSyntaxError<Failure.line, Failure.column, Failure.char_index, FixedLengthString<Failure.error.size() + 1>(Failure.error.data()), Expected> error;
+            throw Failure;
+        }
+        else
+            return Outcome.structure;
+    }
+};
+
+struct JsonPooledString
+{
+    std::size_t source_begin;
+    std::size_t pool_begin;
+    std::size_t size;
+};
+
+// Unescaped string values of a document with every distinct value stored once, a value that is part of an earlier one reuses its
+// characters. Pooled string members built from the document point into it.
+template <FixedLengthString String>
+struct JsonStringLiteralPool
+{
+    static constexpr auto Structure = ParseContext<String>::parse_json();
+
+    // Returns the pooled characters, calling the visitor with every string value and the position of its characters in the pool.
+    static constexpr std::string build_pool(auto &&visitor)
+    {
+        std::string pool;
+        for (const auto &member : Structure.members)
+        {
+            if (member.type != JsonValueType::STRING)
+                continue;
+
+            const auto string_value = member.get_string();
+            auto pool_begin = pool.find(string_value);
+            if (pool_begin == std::string::npos)
+            {
+                pool_begin = pool.size();
+                pool.append(string_value);
+            }
+            visitor(member, pool_begin, string_value.size());
+        }
+        return pool;
+    }
+
+    static constexpr std::size_t StringCount = std::ranges::count(Structure.members, JsonValueType::STRING, &ParseContext<String>::JsonMember::type);
+    static constexpr std::size_t Size = build_pool([](const auto &...) {}).size();
+
+    static constexpr auto Characters = [] {
+        std::array<char, Size> characters{};
+        std::ranges::copy(build_pool([](const auto &...) {}), characters.begin());
+        return characters;
+    }();
+
+    // Ordered by the position of the value in the document.
+    static constexpr auto Strings = [] {
+        std::array<JsonPooledString, StringCount> strings{};
+        std::size_t string_index = 0;
+        build_pool([&](const auto &member, const std::size_t pool_begin, const std::size_t size) { strings[string_index++] = {member.value.begin, pool_begin, size}; });
+        std::ranges::sort(strings, {}, &JsonPooledString::source_begin);
+        return strings;
+    }();
+
+    static constexpr std::string_view find(const std::size_t source_begin) noexcept
+    {
+        const auto found = std::ranges::lower_bound(Strings, source_begin, {}, &JsonPooledString::source_begin);
+        return {Characters.data() + found->pool_begin, found->size};
+    }
+};
+
+// JSON pointer (RFC 6901) resolved at compile time, Path holds the pointer with its null terminator and Begin the start of the
+// remaining segments.
+template <FixedLengthString Path, std::size_t Begin = 0>
+struct JsonPath
+{
+    static constexpr auto Value = Path;
+    static constexpr std::string_view Pointer{Path.string.data(), Path.string.size() - 1};
+    static constexpr bool IsEnd = Begin == Pointer.size();
+    static constexpr std::size_t SegmentEnd = IsEnd ? Begin : std::min(Pointer.find('/', Begin + 1), Pointer.size());
+    static constexpr std::string_view Segment = IsEnd ? std::string_view{} : Pointer.substr(Begin + 1, SegmentEnd - Begin - 1);
+
+    using Next = JsonPath<Path, SegmentEnd>;
 
-        return {children, children_count};
+    static constexpr bool is_array_index() noexcept
+    {
+        return !Segment.empty() && (Segment == "0" || Segment.front() != '0') && std::ranges::all_of(Segment, [](const char c) { return c <= '9' & c >= '0'; });
+    }
+
+    static constexpr std::size_t array_index() noexcept
+    {
+        std::size_t index = 0;
+        for (const auto c : Segment)
+            index = index * 10 + (c - '0');
+        return index;
     }
 };
 
+// Member names are identifiers, so segments never need the ~0 and ~1 escapes.
+constexpr bool is_valid_json_path(const std::string_view path) noexcept
+{
+    if (path.empty())
+        return true;
+
+    if (path.front() != '/' | path.back() == '/' | path.find("//") != std::string_view::npos)
+        return false;
+
+    return path.find('~') == std::string_view::npos;
+}
+
+// Resolves the path to a direct reference, every step is checked against the schema at compile time.
+template <typename Path, typename Value>
+constexpr auto &resolve_json_path(Value &value)
+{
+    using ValueType = std::remove_const_t<Value>;
+
+    if constexpr (Path::IsEnd)
+        return value;
+    else if constexpr (ValueType::JsonType == JsonValueType::OBJECT)
+    {
+        constexpr auto Index = ValueType::find_member_index(Path::Segment);
+        static_assert(Index != ValueType::MemberNames.size(), "The path refers to a member that is not part of the schema.");
+
+        return resolve_json_path<typename Path::Next>(value.template get_member<Index>());
+    }
+    else if constexpr (ValueType::JsonType == JsonValueType::ARRAY)
+    {
+        static_assert(Path::is_array_index(), "The path refers to an array element with a segment that is not an index.");
+        static_assert(std::ranges::find(ValueType::ElementIndices, Path::array_index()) != ValueType::ElementIndices.end(), "The path refers to an array element that is out of range.");
+
+        return resolve_json_path<typename Path::Next>(value.template get<Path::array_index()>());
+    }
+    else
+    {
+        static_assert(Path::IsEnd, "The path continues past a leaf value.");
+        return value;
+    }
+}
+
+// Whether resolve_json_path accepts the path for the schema, for code that has to check a path without failing to compile.
+template <typename Path, typename Value>
+constexpr bool is_json_path_in_schema()
+{
+    using ValueType = std::remove_const_t<Value>;
+
+    if constexpr (Path::IsEnd)
+        return true;
+    else if constexpr (ValueType::JsonType == JsonValueType::OBJECT)
+    {
+        constexpr auto Index = ValueType::find_member_index(Path::Segment);
+        if constexpr (Index == ValueType::MemberNames.size())
+            return false;
+        else
+            return is_json_path_in_schema<typename Path::Next, std::remove_cvref_t<decltype(std::declval<ValueType &>().template get_member<Index>())>>();
+    }
+    else if constexpr (ValueType::JsonType == JsonValueType::ARRAY)
+    {
+        if constexpr (!Path::is_array_index())
+            return false;
+        else if constexpr (std::ranges::find(ValueType::ElementIndices, Path::array_index()) == ValueType::ElementIndices.end())
+            return false;
+        else
+            return is_json_path_in_schema<typename Path::Next, std::remove_cvref_t<decltype(std::declval<ValueType &>().template get<Path::array_index()>())>>();
+    }
+    else
+        return false;
+}
+
 template <JsonValueType Type>
 struct Member
 {
     struct Void
     {
     };
+    static constexpr JsonValueType JsonType = Type;
     Void value;
 
     constexpr Member() noexcept = default;
@@ -626,6 +1040,7 @@ struct Member
 template <>
 struct Member<JsonValueType::BOOL>
 {
+    static constexpr JsonValueType JsonType = JsonValueType::BOOL;
     bool value;
     constexpr Member() noexcept = default;
     constexpr Member(const auto &, const auto &json_member) : value(json_member.get_bool())
@@ -636,6 +1051,7 @@ struct Member<JsonValueType::BOOL>
 template <>
 struct Member<JsonValueType::SIGNED_INTEGER>
 {
+    static constexpr JsonValueType JsonType = JsonValueType::SIGNED_INTEGER;
     std::intmax_t value;
 
     constexpr Member() noexcept = default;
@@ -647,6 +1063,7 @@ struct Member<JsonValueType::SIGNED_INTEGER>
 template <>
 struct Member<JsonValueType::UNSIGNED_INTEGER>
 {
+    static constexpr JsonValueType JsonType = JsonValueType::UNSIGNED_INTEGER;
     std::uintmax_t value;
 
     constexpr Member() noexcept = default;
@@ -658,6 +1075,7 @@ struct Member<JsonValueType::UNSIGNED_INTEGER>
 template <>
 struct Member<JsonValueType::DOUBLE>
 {
+    static constexpr JsonValueType JsonType = JsonValueType::DOUBLE;
     double value;
 
     constexpr Member() noexcept = default;
@@ -669,6 +1087,7 @@ struct Member<JsonValueType::DOUBLE>
 template <>
 struct Member<JsonValueType::STRING>
 {
+    static constexpr JsonValueType JsonType = JsonValueType::STRING;
     std::string value;
 
     Member() noexcept = default; // Make constexpr when possible
@@ -677,9 +1096,34 @@ struct Member<JsonValueType::STRING>
     }
 };
 
-template <FixedLengthString Name, typename Value>
+// String member that refers to pooled characters instead of owning a buffer. Values from the document point into the read-only
+// JsonStringLiteralPool of the document, values assigned at runtime have to come from a JsonStringPool that outlives the member.
+struct PooledStringMember
+{
+    static constexpr JsonValueType JsonType = JsonValueType::STRING;
+    std::string_view value;
+
+    constexpr PooledStringMember() noexcept = default;
+    constexpr PooledStringMember(const auto &, const auto &json_member) : value(json_member.get_pooled_string())
+    {
+    }
+};
+
+template <JsonValueType Type>
+using PooledJsonLeaf = std::conditional_t<Type == JsonValueType::STRING, PooledStringMember, Member<Type>>;
+
+template <std::size_t N>
+constexpr std::string_view json_member_key(const FixedLengthString<N> &name) noexcept
+{
+    return {name.string.data(), N};
+}
+
+// Name is a FixedLengthString spelling out the member name, or a short tag type that is resolved to the name through
+// json_member_key, see InternedName.
+template <auto Name, typename Value>
 struct NamedValue
 {
+    static constexpr std::string_view Key = json_member_key(Name);
     Value value;
     template <typename... Args>
     constexpr NamedValue(Args &&... args) : value(std::forward<Args>(args)...)
@@ -687,9 +1131,10 @@ struct NamedValue
     }
 };
 
-template <std::size_t Index, typename Value>
-struct IndexedValue : Value
+template <std::size_t IIndex, typename Value>
+struct IndexedValue
 {
+    static constexpr std::size_t Index = IIndex;
     Value value;
     template <typename... Args>
     constexpr IndexedValue(Args &&... args) : value(std::forward<Args>(args)...)
@@ -700,6 +1145,10 @@ struct IndexedValue : Value
 template <typename... Members>
 struct Array : Members...
 {
+    static constexpr JsonValueType JsonType = JsonValueType::ARRAY;
+    static constexpr std::size_t Size = sizeof...(Members);
+    static constexpr std::array<std::size_t, sizeof...(Members)> ElementIndices{Members::Index...};
+
     constexpr Array() noexcept = default;
 
     template <std::size_t... Indices>
@@ -711,6 +1160,13 @@ struct Array : Members...
     {
     }
 
+    // Constructs every element from the source of its position, used by the interned types so the parse result doesn't show up in
+    // their constructor signatures.
+    template <typename Source, std::size_t... Indices>
+    constexpr Array(const Source &, const std::index_sequence<Indices...> &) : Members(Source{}, typename Source::template Child<Indices>{})...
+    {
+    }
+
     template <std::size_t Index, typename ValueType>
     static constexpr auto &get_impl(IndexedValue<Index, ValueType> &member)
     {
@@ -734,11 +1190,173 @@ struct Array : Members...
     {
         return get_impl<Index>(*this);
     }
+
+    template <FixedLengthString Path>
+    constexpr auto &operator[](const JsonPath<Path> &)
+    {
+        return resolve_json_path<JsonPath<Path>>(*this);
+    }
+
+    template <FixedLengthString Path>
+    constexpr const auto &operator[](const JsonPath<Path> &) const
+    {
+        return resolve_json_path<JsonPath<Path>>(*this);
+    }
+
+    template <typename Self, typename Visitor, std::size_t... Indices>
+    static constexpr bool visit_element_impl(Self &self, const std::size_t index, Visitor &visitor, const std::index_sequence<Indices...> &)
+    {
+        return ((index == Indices && (visitor(static_cast<std::conditional_t<std::is_const_v<Self>, const Members, Members> &>(self).value), true)) || ...);
+    }
+
+    // Calls the visitor with the element at a runtime position, returns false if the position is out of range.
+    template <typename Visitor>
+    constexpr bool visit_element(const std::size_t index, Visitor &&visitor)
+    {
+        return visit_element_impl(*this, index, visitor, std::index_sequence_for<Members...>{});
+    }
+
+    template <typename Visitor>
+    constexpr bool visit_element(const std::size_t index, Visitor &&visitor) const
+    {
+        return visit_element_impl(*this, index, visitor, std::index_sequence_for<Members...>{});
+    }
 };
 
+// Array whose elements all have the same shape, stored contiguously as a single element type instead of one base per element.
+template <typename Element, std::size_t N>
+struct UniformArray
+{
+    static constexpr JsonValueType JsonType = JsonValueType::ARRAY;
+    static constexpr std::size_t Size = N;
+    static constexpr auto ElementIndices = [] {
+        std::array<std::size_t, N> indices{};
+        for (std::size_t index = 0; index < N; index++)
+            indices[index] = index;
+        return indices;
+    }();
+
+    using ElementType = Element;
+
+    std::array<Element, N> elements;
+
+    constexpr UniformArray() noexcept = default;
+
+    template <std::size_t... Indices>
+    constexpr UniformArray(const auto &json_members, const auto &json_member, const std::index_sequence<Indices...> &) : elements{Element(std::ranges::subrange(json_members.begin() + json_member.object_start + json_member.member_count, json_members.end()), json_members[json_member.object_start + Indices])...}
+    {
+    }
+
+    constexpr UniformArray(const auto &json_members, const auto &json_member) : UniformArray(json_members, json_member, std::make_index_sequence<N>())
+    {
+    }
+
+    template <std::size_t Index>
+    constexpr auto &get()
+    {
+        static_assert(Index < N, "The array element is out of range.");
+        return std::get<Index>(elements);
+    }
+
+    template <std::size_t Index>
+    constexpr const auto &get() const
+    {
+        static_assert(Index < N, "The array element is out of range.");
+        return std::get<Index>(elements);
+    }
+
+    constexpr Element &operator[](const std::size_t index)
+    {
+        return elements[index];
+    }
+
+    constexpr const Element &operator[](const std::size_t index) const
+    {
+        return elements[index];
+    }
+
+    template <FixedLengthString Path>
+    constexpr auto &operator[](const JsonPath<Path> &)
+    {
+        return resolve_json_path<JsonPath<Path>>(*this);
+    }
+
+    template <FixedLengthString Path>
+    constexpr const auto &operator[](const JsonPath<Path> &) const
+    {
+        return resolve_json_path<JsonPath<Path>>(*this);
+    }
+
+    constexpr auto begin() noexcept
+    {
+        return elements.begin();
+    }
+
+    constexpr auto begin() const noexcept
+    {
+        return elements.begin();
+    }
+
+    constexpr auto end() noexcept
+    {
+        return elements.end();
+    }
+
+    constexpr auto end() const noexcept
+    {
+        return elements.end();
+    }
+
+    static constexpr std::size_t size() noexcept
+    {
+        return N;
+    }
+
+    // Calls the visitor with the element at a runtime position, returns false if the position is out of range.
+    template <typename Visitor>
+    constexpr bool visit_element(const std::size_t index, Visitor &&visitor)
+    {
+        return index < N && (visitor(elements[index]), true);
+    }
+
+    template <typename Visitor>
+    constexpr bool visit_element(const std::size_t index, Visitor &&visitor) const
+    {
+        return index < N && (visitor(elements[index]), true);
+    }
+};
+
+template <typename Value>
+constexpr bool is_uniform_json_array = false;
+
+template <typename Element, std::size_t N>
+constexpr bool is_uniform_json_array<UniformArray<Element, N>> = true;
+
 template <typename... Members>
 struct Json : Members...
 {
+    static constexpr JsonValueType JsonType = JsonValueType::OBJECT;
+    static constexpr std::array<std::string_view, sizeof...(Members)> MemberNames{Members::Key...};
+
+    // Member indices ordered by name so runtime keys can be routed with a binary search.
+    static constexpr auto SortedMemberIndices = [] {
+        std::array<std::size_t, sizeof...(Members)> indices{};
+        for (std::size_t index = 0; index < indices.size(); index++)
+            indices[index] = index;
+        std::ranges::sort(indices, {}, [](const std::size_t index) { return MemberNames[index]; });
+        return indices;
+    }();
+
+    // Returns the index of the member with the given name or sizeof...(Members) if there is none.
+    static constexpr std::size_t find_member_index(const std::string_view name) noexcept
+    {
+        const auto found = std::ranges::lower_bound(SortedMemberIndices, name, {}, [](const std::size_t index) { return MemberNames[index]; });
+        return found != SortedMemberIndices.end() && MemberNames[*found] == name ? *found : sizeof...(Members);
+    }
+
+    template <FixedLengthString Name>
+    static constexpr std::size_t member_index = find_member_index(std::string_view{Name.string.data(), Name.string.size()});
+
     constexpr Json() noexcept = default;
 
     template <std::size_t... Indices>
@@ -754,52 +1372,95 @@ struct Json : Members...
     {
     }
 
-    static constexpr void get_impl(const auto&)
+    // Constructs every member from the source of its index, used by the interned types so the parse result doesn't show up in their
+    // constructor signatures.
+    template <typename Source, std::size_t... Indices>
+    constexpr Json(const Source &, const std::index_sequence<Indices...> &) : Members(Source{}, typename Source::template Child<Indices>{})...
     {
-        throw "InvalidMemberAccess";
     }
 
-    template <FixedLengthString Name, typename ValueType>
-    static constexpr auto &get_impl(NamedValue<Name, ValueType> &member)
+    // Members are looked up by index rather than by matching the name against the bases, so interned names resolve the same way.
+    template <typename Self, FixedLengthString Name>
+    static constexpr decltype(auto) get_impl(Self &self)
     {
-        return member.value;
+        if constexpr (member_index<Name> == sizeof...(Members))
+            throw "InvalidMemberAccess";
+        else
+            return self.template get_member<member_index<Name>>();
     }
 
     template <auto Name>
     constexpr decltype(auto) get()
     {
-        return ((get_impl<Name.Value>(*this)));
+        return get_impl<Json, Name.Value>(*this);
     }
 
     template <FixedLengthString Name>
     constexpr decltype(auto) operator[](const CompileTimeValueHolder<Name>&)
     {
-        return ((get_impl<Name>(*this)));
-    }
-
-    template <FixedLengthString Name, typename ValueType>
-    static constexpr const auto &get_impl(const NamedValue<Name, ValueType> &member)
-    {
-        return member.value;
+        return get_impl<Json, Name>(*this);
     }
 
     template <auto Name>
     constexpr decltype(auto) get() const
     {
-        return ((get_impl<Name.Value>(*this)));
+        return get_impl<const Json, Name.Value>(*this);
     }
 
     template <FixedLengthString Name>
     constexpr decltype(auto) operator[](const CompileTimeValueHolder<Name>&) const
     {
-        return ((get_impl<Name>(*this)));
+        return get_impl<const Json, Name>(*this);
+    }
+
+    template <std::size_t Index>
+    constexpr auto &get_member()
+    {
+        return static_cast<std::tuple_element_t<Index, std::tuple<Members...>> &>(*this).value;
+    }
+
+    template <std::size_t Index>
+    constexpr const auto &get_member() const
+    {
+        return static_cast<const std::tuple_element_t<Index, std::tuple<Members...>> &>(*this).value;
+    }
+
+    template <FixedLengthString Path>
+    constexpr auto &operator[](const JsonPath<Path> &)
+    {
+        return resolve_json_path<JsonPath<Path>>(*this);
+    }
+
+    template <FixedLengthString Path>
+    constexpr const auto &operator[](const JsonPath<Path> &) const
+    {
+        return resolve_json_path<JsonPath<Path>>(*this);
+    }
+
+    template <typename Self, typename Visitor, std::size_t... Indices>
+    static constexpr bool visit_member_impl(Self &self, const std::size_t index, Visitor &visitor, const std::index_sequence<Indices...> &)
+    {
+        return ((index == Indices && (visitor(static_cast<std::conditional_t<std::is_const_v<Self>, const Members, Members> &>(self).value), true)) || ...);
+    }
+
+    // Calls the visitor with the value of the member at a runtime index, returns false if the index is out of range.
+    template <typename Visitor>
+    constexpr bool visit_member(const std::size_t index, Visitor &&visitor)
+    {
+        return visit_member_impl(*this, index, visitor, std::index_sequence_for<Members...>{});
+    }
+
+    template <typename Visitor>
+    constexpr bool visit_member(const std::size_t index, Visitor &&visitor) const
+    {
+        return visit_member_impl(*this, index, visitor, std::index_sequence_for<Members...>{});
     }
 };
 
-template <JsonValueType ValueType, typename>
+template <JsonValueType ValueType, typename StructureMembersView>
 struct MemberTypeSelector
 {
-    using MemberType = Member<ValueType>;
+    using MemberType = typename StructureMembersView::template LeafType<ValueType>;
 };
 
 template <typename StructureMembersView>
@@ -817,16 +1478,59 @@ struct MemberTypeSelector<JsonValueType::ARRAY, StructureMembersView>
     template <std::size_t Index, typename  StructureMembersView::JsonMemberType Member>
     using ChildMemberType = IndexedValue<Index,
                                         typename MemberTypeSelector<Member.type, typename StructureMembersView::template NextViewSubView<Member.object_start, Member.member_count>>::MemberType>;
-    using MemberType = typename StructureMembersView::template EnumerateView<ChildMemberType, Array>;
+
+    // Arrays of same shaped elements only instantiate the type of the first element.
+    static constexpr auto select_type()
+    {
+        if constexpr (StructureMembersView::IsUniform)
+        {
+            constexpr auto FirstMember = StructureMembersView::template ViewMember<0>;
+            using ElementType = typename MemberTypeSelector<FirstMember.type, typename StructureMembersView::template NextViewSubView<FirstMember.object_start, FirstMember.member_count>>::MemberType;
+            return std::type_identity<UniformArray<ElementType, StructureMembersView::Count>>{};
+        }
+        else
+            return std::type_identity<typename StructureMembersView::template EnumerateView<ChildMemberType, Array>>{};
+    }
+
+    using MemberType = typename decltype(select_type())::type;
 };
 
-template <auto JsonEarlyStructure>
+// Compares the shapes of two parsed values, each given with the end of the view it belongs to since children are placed relative to it.
+constexpr bool is_same_json_shape(const auto &members, const std::size_t left_view_end, const auto &left, const std::size_t right_view_end, const auto &right)
+{
+    if (left.type != right.type)
+        return false;
+    if (left.type != JsonValueType::OBJECT & left.type != JsonValueType::ARRAY)
+        return true;
+    if (left.member_count != right.member_count)
+        return false;
+
+    const auto left_begin = left_view_end + left.object_start;
+    const auto right_begin = right_view_end + right.object_start;
+    for (std::size_t index = 0; index < left.member_count; index++)
+    {
+        const auto &left_child = members[left_begin + index];
+        const auto &right_child = members[right_begin + index];
+
+        if (left.type == JsonValueType::OBJECT && std::string_view{left_child.name} != std::string_view{right_child.name})
+            return false;
+        if (!is_same_json_shape(members, left_begin + left.member_count, left_child, right_begin + right.member_count, right_child))
+            return false;
+    }
+    return true;
+}
+
+// Leaf picks the member type of every value that is not an object or an array, like PooledJsonLeaf.
+template <auto JsonEarlyStructure, template <JsonValueType> typename Leaf = Member>
 struct JsonStructureContext
 {
     template <std::size_t Begin, std::size_t MemberCount>
     struct View
     {
         using JsonMemberType = typename  decltype(JsonEarlyStructure)::JsonMemberType;
+
+        template <JsonValueType Type>
+        using LeafType = Leaf<Type>;
         template <template <std::size_t, JsonMemberType> typename ElementHolder>
         struct Zipper
         {
@@ -839,6 +1543,20 @@ struct JsonStructureContext
 
         template <std::size_t SubViewBegin, std::size_t SubViewMemberCount>
         using NextViewSubView = View<SubViewBegin + Begin + MemberCount, SubViewMemberCount>;
+
+        static constexpr std::size_t Count = MemberCount;
+
+        template <std::size_t Index>
+        static constexpr JsonMemberType ViewMember = JsonEarlyStructure.members[Begin + Index];
+
+        // True if the view is not empty and every member has the shape of the first one.
+        static constexpr bool IsUniform = [] {
+            constexpr auto &Members = JsonEarlyStructure.members;
+            for (std::size_t index = 1; index < MemberCount; index++)
+                if (!is_same_json_shape(Members, Begin + MemberCount, Members[Begin], Begin + MemberCount, Members[Begin + index]))
+                    return false;
+            return MemberCount != 0;
+        }();
     };
 
     using JsonStructure = typename MemberTypeSelector<JsonValueType::OBJECT, View<0, JsonEarlyStructure.children_count>>::MemberType;
@@ -850,10 +1568,17 @@ constexpr auto operator"" _member()
     return CompileTimeValueHolder<FixedLengthString<String.string.size() - 1>(String.string.data())>{};
 }
 
-template <auto JsonEarlySturcture>
+template <FixedLengthString String>
+constexpr auto operator"" _path()
+{
+    static_assert(is_valid_json_path(std::string_view{String.string.data(), String.string.size() - 1}), "A JSON path has to be empty or made of non-empty segments each starting with '/'.");
+    return JsonPath<String>{};
+}
+
+template <auto JsonEarlySturcture, template <JsonValueType> typename Leaf = Member>
 constexpr auto construct_json()
 {
-    return typename JsonStructureContext<JsonEarlySturcture>::JsonStructure{JsonEarlySturcture.members, 0, JsonEarlySturcture.children_count};
+    return typename JsonStructureContext<JsonEarlySturcture, Leaf>::JsonStructure{JsonEarlySturcture.members, 0, JsonEarlySturcture.children_count};
 }
 
 template <FixedLengthString String>
@@ -864,6 +1589,161 @@ constexpr auto operator"" _json()
     return construct_json<Context::parse_json()>();
 }
 
+// Like _json but string members are PooledStringMember, so equal strings of the document share one read-only copy and objects
+// without runtime strings can be constexpr.
+template <FixedLengthString String>
+constexpr auto operator"" _pooled_json()
+{
+    return construct_json<JsonStringLiteralPool<String>::Structure, PooledJsonLeaf>();
+}
+
+// Opt-in encoding for large documents. The types built by construct_json spell out every member name and the whole nested structure
+// in their template arguments, so mangled names and debug info grow with the size of the document. Interned types refer to a tag type
+// and positions in its parsed structure instead, the name of every node stays short and only lists its direct members. Document is a
+// tag type holding the document in a static constexpr FixedLengthString Source.
+template <typename Document>
+struct InternedJsonStructure
+{
+    static constexpr auto Value = ParseContext<Document::Source>::parse_json();
+};
+
+template <typename Document, std::size_t Position>
+struct InternedName
+{
+    static constexpr auto Name = InternedJsonStructure<Document>::Value.members[Position].name;
+    static constexpr std::string_view Key{Document::Source.string.data() + Name.begin, Name.end - Name.begin};
+};
+
+template <typename Document, std::size_t Position>
+constexpr std::string_view json_member_key(const InternedName<Document, Position> &) noexcept
+{
+    return InternedName<Document, Position>::Key;
+}
+
+// Stands in for the parsed member at Position. Values are read at compile time so the functions of the ParseContext, whose names
+// contain the whole document, are never emitted.
+template <typename Document, std::size_t Position>
+struct InternedJsonMember
+{
+    static constexpr auto Parsed = InternedJsonStructure<Document>::Value.members[Position];
+
+    constexpr bool get_bool() const
+    {
+        constexpr auto Value = Parsed.get_bool();
+        return Value;
+    }
+
+    constexpr std::intmax_t get_signed_integer() const
+    {
+        constexpr auto Value = Parsed.get_signed_integer();
+        return Value;
+    }
+
+    constexpr std::uintmax_t get_unsigned_integer() const
+    {
+        constexpr auto Value = Parsed.get_unsigned_integer();
+        return Value;
+    }
+
+    constexpr double get_double() const
+    {
+        constexpr auto Value = Parsed.get_double();
+        return Value;
+    }
+
+    constexpr std::string get_string() const
+    {
+        constexpr std::string_view Value{Document::Source.string.data() + Parsed.value.begin, Parsed.value.end - Parsed.value.begin};
+        return unescape_json_string(Value);
+    }
+};
+
+template <typename Document, std::size_t Begin>
+struct InternedJsonView
+{
+    template <std::size_t Index>
+    using Child = InternedJsonMember<Document, Begin + Index>;
+};
+
+template <typename Document, std::size_t Begin, std::size_t MemberCount>
+struct InternedJson;
+
+template <typename Document, std::size_t Begin, std::size_t MemberCount>
+struct InternedArray;
+
+template <typename Document, std::size_t Begin, std::size_t MemberCount>
+struct InternedJsonLayout
+{
+    template <std::size_t Index>
+    static constexpr auto Parsed = InternedJsonStructure<Document>::Value.members[Begin + Index];
+
+    template <std::size_t Index>
+    static constexpr auto select_child_type()
+    {
+        constexpr auto ChildBegin = Begin + MemberCount + Parsed<Index>.object_start;
+
+        if constexpr (Parsed<Index>.type == JsonValueType::OBJECT)
+            return std::type_identity<InternedJson<Document, ChildBegin, Parsed<Index>.member_count>>{};
+        else if constexpr (Parsed<Index>.type == JsonValueType::ARRAY)
+            return std::type_identity<InternedArray<Document, ChildBegin, Parsed<Index>.member_count>>{};
+        else
+            return std::type_identity<Member<Parsed<Index>.type>>{};
+    }
+
+    template <std::size_t Index>
+    using ChildType = typename decltype(select_child_type<Index>())::type;
+
+    template <std::size_t Index>
+    using NamedChild = NamedValue<InternedName<Document, Begin + Index>{}, ChildType<Index>>;
+
+    template <std::size_t Index>
+    using IndexedChild = IndexedValue<Index, ChildType<Index>>;
+
+    using ObjectType = Enumerate<NamedChild, Json, MemberCount>;
+    using ArrayType = Enumerate<IndexedChild, Array, MemberCount>;
+};
+
+template <typename Document, std::size_t Begin, std::size_t MemberCount>
+struct InternedJson : InternedJsonLayout<Document, Begin, MemberCount>::ObjectType
+{
+    using Base = typename InternedJsonLayout<Document, Begin, MemberCount>::ObjectType;
+
+    constexpr InternedJson() noexcept = default;
+
+    explicit constexpr InternedJson(const InternedJsonView<Document, Begin> &view) : Base(view, std::make_index_sequence<MemberCount>())
+    {
+    }
+
+    constexpr InternedJson(const auto &, const auto &) : InternedJson(InternedJsonView<Document, Begin>{})
+    {
+    }
+};
+
+template <typename Document, std::size_t Begin, std::size_t MemberCount>
+struct InternedArray : InternedJsonLayout<Document, Begin, MemberCount>::ArrayType
+{
+    using Base = typename InternedJsonLayout<Document, Begin, MemberCount>::ArrayType;
+
+    constexpr InternedArray() noexcept = default;
+
+    explicit constexpr InternedArray(const InternedJsonView<Document, Begin> &view) : Base(view, std::make_index_sequence<MemberCount>())
+    {
+    }
+
+    constexpr InternedArray(const auto &, const auto &) : InternedArray(InternedJsonView<Document, Begin>{})
+    {
+    }
+};
+
+template <typename Document>
+using InternedJsonType = InternedJson<Document, 0, InternedJsonStructure<Document>::Value.children_count>;
+
+template <typename Document>
+constexpr auto construct_interned_json()
+{
+    return InternedJsonType<Document>{InternedJsonView<Document, 0>{}};
+}
+
 template <typename Range>
 constexpr void print_json(
     const Range &children,
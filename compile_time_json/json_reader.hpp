@@ -0,0 +1,290 @@
+#pragma once
+
+#include "compile_time_json/compile_time_json.hpp"
+#include "compile_time_json/json_string_pool.hpp"
+
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+// Cursor over a runtime JSON buffer that decodes directly into the types generated for a _json schema.
+// Accepts the same dialect as the compile time parser (trailing commas, leading or trailing dots on numbers) plus '\r' as white space.
+struct JsonReader
+{
+    using FailureResult = JsonParseFailure;
+
+    std::string_view input;
+    std::size_t position{0};
+    // Storage for strings decoded into pooled string members, only needed for schemas built with _pooled_json.
+    JsonStringPool *string_pool{nullptr};
+
+    [[noreturn]] void fail(const std::string_view error, const std::size_t char_index, const JsonExpectedTokens expected = JsonExpectedTokens::NONE) const
+    {
+        throw locate_json_parse_failure(input, error, char_index, expected);
+    }
+
+    [[noreturn]] void fail(const std::string_view error) const
+    {
+        fail(error, position);
+    }
+
+    constexpr bool is_end() const noexcept
+    {
+        return position >= input.size();
+    }
+
+    constexpr char peek() const noexcept
+    {
+        return is_end() ? '\0' : input[position];
+    }
+
+    constexpr void skip_white_space() noexcept
+    {
+        while (!is_end() && (input[position] == ' ' | input[position] == '\t' | input[position] == '\n' | input[position] == '\r'))
+            position++;
+    }
+
+    void expect(const char c, const std::string_view error, const JsonExpectedTokens expected)
+    {
+        if (peek() != c)
+            fail(error, position, expected);
+        position++;
+    }
+
+    void expect(const char c, const std::string_view error)
+    {
+        expect(c, error, json_expected_token(c));
+    }
+
+    constexpr bool read_literal(const std::string_view literal) noexcept
+    {
+        if (input.substr(position, literal.size()) != literal)
+            return false;
+        position += literal.size();
+        return true;
+    }
+
+    // Returns the raw (still escaped) contents of a string and leaves the cursor after the closing quote.
+    std::string_view read_string_token()
+    {
+        expect('"', "Expected a string.");
+        const auto begin = position;
+
+        bool is_in_escape_state = false;
+        for (; !is_end(); position++)
+        {
+            const char c = input[position];
+            if (is_in_escape_state)
+                is_in_escape_state = false;
+            else if (c == '\\')
+                is_in_escape_state = true;
+            else if (c == '"')
+                return input.substr(begin, position++ - begin);
+        }
+
+        fail("Unterminated string.", position, JsonExpectedTokens::QUOTE);
+    }
+
+    std::string_view read_number_token()
+    {
+        const auto begin = position;
+        while (!is_end())
+        {
+            const char c = input[position];
+            if (!((c <= '9' & c >= '0') | c == '-' | c == '+' | c == '.' | c == 'e' | c == 'E'))
+                break;
+            position++;
+        }
+
+        if (begin == position)
+            fail("Expected a value but couldn't find any.", position, JsonExpectedTokens::VALUE);
+
+        return input.substr(begin, position - begin);
+    }
+
+    // Skips an object or array by balancing brackets without decoding anything inside it, every closing bracket has to match the
+    // kind of its opening one.
+    void skip_container()
+    {
+        const auto begin = position;
+        std::string closing_brackets;
+        do
+        {
+            if (is_end())
+                fail("Unterminated object or array.", begin);
+
+            switch (input[position])
+            {
+            case '"':
+                read_string_token();
+                continue;
+            case '{':
+                closing_brackets.push_back('}');
+                break;
+            case '[':
+                closing_brackets.push_back(']');
+                break;
+            case '}':
+            case ']':
+                if (input[position] != closing_brackets.back())
+                    fail("Mismatched closing bracket.", position, json_expected_token(closing_brackets.back()));
+                closing_brackets.pop_back();
+                break;
+            }
+            position++;
+        } while (!closing_brackets.empty());
+    }
+
+    void skip_value()
+    {
+        skip_white_space();
+        switch (peek())
+        {
+        case '"':
+            read_string_token();
+            return;
+        case '{':
+        case '[':
+            skip_container();
+            return;
+        case 't':
+            if (read_literal("true"))
+                return;
+            break;
+        case 'f':
+            if (read_literal("false"))
+                return;
+            break;
+        case 'n':
+            if (read_literal("null"))
+                return;
+            break;
+        default:
+            read_number_token();
+            return;
+        }
+
+        fail("Expected a value but couldn't find any.", position, JsonExpectedTokens::VALUE);
+    }
+
+    // Calls the handler with each member name while the cursor is at the start of the member value, the handler must consume the value.
+    template <typename MemberHandler>
+    void read_object(MemberHandler &&member_handler)
+    {
+        skip_white_space();
+        expect('{', "Expected '{'.");
+        skip_white_space();
+
+        while (peek() != '}')
+        {
+            const auto name = read_string_token();
+            skip_white_space();
+            expect(':', "Expected ':' after the member name.");
+            skip_white_space();
+
+            member_handler(name);
+
+            skip_white_space();
+            if (peek() != ',')
+                break;
+            position++;
+            skip_white_space();
+        }
+
+        expect('}', "Expected ',' or '}'.", JsonExpectedTokens::COMMA | JsonExpectedTokens::OBJECT_END);
+    }
+
+    // Calls the handler with each element index while the cursor is at the start of the element, the handler must consume the element.
+    // Returns the number of elements.
+    template <typename ElementHandler>
+    std::size_t read_array(ElementHandler &&element_handler)
+    {
+        skip_white_space();
+        expect('[', "Expected '['.");
+        skip_white_space();
+
+        std::size_t element_count = 0;
+        while (peek() != ']')
+        {
+            element_handler(element_count++);
+
+            skip_white_space();
+            if (peek() != ',')
+                break;
+            position++;
+            skip_white_space();
+        }
+
+        expect(']', "Expected ',' or ']'.", JsonExpectedTokens::COMMA | JsonExpectedTokens::ARRAY_END);
+        return element_count;
+    }
+
+    template <typename Number>
+    void read_number(Number &number)
+    {
+        const auto begin = position;
+        if (const char c = peek(); !((c <= '9' & c >= '0') | c == '-' | c == '.'))
+            fail("Expected a number.", begin, JsonExpectedTokens::DIGIT | JsonExpectedTokens::DOT);
+
+        const auto token = read_number_token();
+        const auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), number);
+
+        if (error != std::errc{} || end != token.data() + token.size())
+            fail("The number does not fit the type of the schema member.", begin);
+    }
+
+    // Decodes the value at the cursor into a member, object or array generated from a schema. Members that are missing from the
+    // input keep their previous values and members that are not in the schema are skipped.
+    template <typename Value>
+    void read_value(Value &target)
+    {
+        skip_white_space();
+
+        if constexpr (Value::JsonType == JsonValueType::OBJECT)
+            read_object([&](const std::string_view name) {
+                if (!target.visit_member(Value::find_member_index(name), [&](auto &member) { read_value(member); }))
+                    skip_value();
+            });
+        else if constexpr (Value::JsonType == JsonValueType::ARRAY)
+        {
+            const auto begin = position;
+            const auto element_count = read_array([&](const std::size_t index) {
+                if (!target.visit_element(index, [&](auto &element) { read_value(element); }))
+                    fail("The array has more elements than the schema.");
+            });
+
+            if (element_count != Value::Size)
+                fail("The array has fewer elements than the schema.", begin);
+        }
+        else if constexpr (Value::JsonType == JsonValueType::BOOL)
+        {
+            if (read_literal("true"))
+                target.value = true;
+            else if (read_literal("false"))
+                target.value = false;
+            else
+                fail("Expected a boolean.", position, JsonExpectedTokens::LITERAL);
+        }
+        else if constexpr (Value::JsonType == JsonValueType::STRING)
+        {
+            if constexpr (std::is_same_v<Value, PooledStringMember>)
+            {
+                if (!string_pool)
+                    fail("Pooled string members can only be read with a string pool.");
+
+                const auto token = read_string_token();
+                target.value = token.find('\\') == std::string_view::npos ? string_pool->intern(token) : string_pool->intern(unescape_json_string(token));
+            }
+            else
+                target.value = unescape_json_string(read_string_token());
+        }
+        else if constexpr (Value::JsonType == JsonValueType::NULL_VALUE)
+        {
+            if (!read_literal("null"))
+                fail("Expected null.", position, JsonExpectedTokens::LITERAL);
+        }
+        else
+            read_number(target.value);
+    }
+};
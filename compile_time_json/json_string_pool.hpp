@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <memory_resource>
+#include <string_view>
+#include <unordered_set>
+
+// Deduplicating storage for the strings assigned to pooled string members at runtime. Every distinct string is allocated once from the
+// memory resource and stays valid until the pool is destroyed, so handing it a monotonic or pool resource keeps allocator traffic low.
+struct JsonStringPool
+{
+    explicit JsonStringPool(std::pmr::memory_resource *const i_resource = std::pmr::get_default_resource()) : resource(i_resource), strings(i_resource)
+    {
+    }
+
+    JsonStringPool(const JsonStringPool &) = delete;
+    JsonStringPool &operator=(const JsonStringPool &) = delete;
+
+    ~JsonStringPool()
+    {
+        for (const auto string : strings)
+            resource->deallocate(const_cast<char *>(string.data()), string.size(), alignof(char));
+    }
+
+    // Returns a view of the pooled copy of the string, equal strings share the same characters.
+    std::string_view intern(const std::string_view string)
+    {
+        if (string.empty())
+            return {};
+
+        if (const auto found = strings.find(string); found != strings.end())
+            return *found;
+
+        auto *const characters = static_cast<char *>(resource->allocate(string.size(), alignof(char)));
+        std::ranges::copy(string, characters);
+        return *strings.emplace(characters, string.size()).first;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return strings.size();
+    }
+
+    std::pmr::memory_resource *get_resource() const noexcept
+    {
+        return resource;
+    }
+
+private:
+    std::pmr::memory_resource *resource;
+    std::pmr::unordered_set<std::string_view> strings;
+};
@@ -0,0 +1,198 @@
+#include "compile_time_json/json_reader.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+// Host tool behind json_struct_library. Reads a JSON file and writes a header with the fully resolved Json type of the file and an
+// extern constant, and a source file defining that constant from the _json literal so only one translation unit parses it.
+//
+// Usage: json_struct_generator <input.json> <output.hpp> <output.cc> <header include path> <type name> <variable name>
+
+constexpr std::string_view RawStringDelimiter = "json_struct";
+
+struct JsonStructGenerator
+{
+    JsonReader reader;
+    std::string type;
+
+    void indent(const std::size_t depth)
+    {
+        type.append(4 * depth, ' ');
+    }
+
+    // Mirrors the value grammar of ParseContext::parse_value so the emitted type matches what the _json literal produces.
+    void generate_value(const std::size_t depth)
+    {
+        reader.skip_white_space();
+        const auto value_position = reader.position;
+
+        switch (reader.peek())
+        {
+        case '{':
+            type.append("Json<");
+            generate_members(depth);
+            type.append(">");
+            return;
+        case '[':
+            generate_array(depth);
+            return;
+        case '"':
+        {
+            // ParseString only accepts these characters escaped.
+            const auto string = reader.read_string_token();
+            if (const auto control_position = string.find_first_of("\t\n\b\f\r"); control_position != std::string_view::npos)
+                reader.fail("Strings can not contain raw control characters.", string.data() + control_position - reader.input.data());
+
+            type.append("Member<JsonValueType::STRING>");
+            return;
+        }
+        case 'n':
+            if (!reader.read_literal("null"))
+                break;
+            type.append("Member<JsonValueType::NULL_VALUE>");
+            return;
+        case 't':
+        case 'f':
+            if (!reader.read_literal("true") && !reader.read_literal("false"))
+                break;
+            type.append("Member<JsonValueType::BOOL>");
+            return;
+        default:
+        {
+            const auto token = reader.read_number_token();
+            const auto digits = token.substr(token.front() == '-');
+            const auto dot_position = digits.find('.');
+            const auto is_digits = [](const std::string_view part) { return std::ranges::all_of(part, [](const char c) { return c <= '9' & c >= '0'; }); };
+
+            if (dot_position == std::string_view::npos && !digits.empty() && is_digits(digits))
+                type.append(token.front() == '-' ? "Member<JsonValueType::SIGNED_INTEGER>" : "Member<JsonValueType::UNSIGNED_INTEGER>");
+            else if (dot_position != std::string_view::npos && digits.size() > 1 && is_digits(digits.substr(0, dot_position)) && is_digits(digits.substr(dot_position + 1)))
+                type.append("Member<JsonValueType::DOUBLE>");
+            else
+                reader.fail("The number is not supported by the compile time parser.", value_position);
+            return;
+        }
+        }
+
+        reader.fail("Expected a value but couldn't find any.", value_position);
+    }
+
+    void generate_members(const std::size_t depth)
+    {
+        bool is_first_member = true;
+        reader.read_object([&](const std::string_view name) {
+            const auto is_identifier_character = [](const char c) { return (c <= 'z' & c >= 'a') | (c <= 'Z' & c >= 'A') | (c <= '9' & c >= '0') | c == '_'; };
+            if (name.empty() || (name.front() <= '9' & name.front() >= '0') || name.front() == '_' || !std::ranges::all_of(name, is_identifier_character))
+                reader.fail("Member names have to be identifiers.", name.data() - reader.input.data());
+
+            type.append(is_first_member ? "\n" : ",\n");
+            is_first_member = false;
+
+            indent(depth + 1);
+            type.append("NamedValue<FixedLengthString<").append(std::to_string(name.size())).append(">(\"").append(name).append("\"), ");
+            generate_value(depth + 1);
+            type.append(">");
+        });
+    }
+
+    // Like MemberTypeSelector, arrays whose elements all have the same type become a UniformArray of that type.
+    void generate_array(const std::size_t depth)
+    {
+        std::vector<std::string> element_types;
+        reader.read_array([&](std::size_t) {
+            std::string element_type;
+            std::swap(type, element_type);
+            generate_value(depth + 1);
+            std::swap(type, element_type);
+            element_types.push_back(std::move(element_type));
+        });
+
+        if (!element_types.empty() && std::ranges::all_of(element_types, [&](const std::string &element_type) { return element_type == element_types.front(); }))
+        {
+            type.append("UniformArray<\n");
+            indent(depth + 1);
+            type.append(element_types.front()).append(",\n");
+            indent(depth + 1);
+            type.append(std::to_string(element_types.size())).append(">");
+            return;
+        }
+
+        type.append("Array<");
+        for (std::size_t index = 0; index < element_types.size(); index++)
+        {
+            type.append(index ? ",\n" : "\n");
+
+            indent(depth + 1);
+            type.append("IndexedValue<").append(std::to_string(index)).append(", ").append(element_types[index]).append(">");
+        }
+        type.append(">");
+    }
+};
+
+int main(const int argc, const char *const argv[])
+{
+    if (argc != 7)
+    {
+        std::cerr << "Usage: " << argv[0] << " <input.json> <output.hpp> <output.cc> <header include path> <type name> <variable name>" << std::endl;
+        return 1;
+    }
+
+    const std::string_view input_path = argv[1], header_path = argv[2], source_path = argv[3], header_include = argv[4], type_name = argv[5], variable_name = argv[6];
+
+    std::ifstream input_file{std::string{input_path}, std::ios::binary};
+    if (!input_file)
+    {
+        std::cerr << "Could not open " << input_path << std::endl;
+        return 1;
+    }
+
+    std::stringstream input_stream;
+    input_stream << input_file.rdbuf();
+
+    // The compile time parser only accepts '\n' line endings, a raw '\r' is not valid inside strings either.
+    auto input = input_stream.str();
+    std::erase(input, '\r');
+
+    if (input.find(std::string{")"}.append(RawStringDelimiter).append("\"")) != std::string::npos)
+    {
+        std::cerr << input_path << " contains the raw string delimiter " << RawStringDelimiter << std::endl;
+        return 1;
+    }
+
+    JsonStructGenerator generator{JsonReader{input}, {}};
+    try
+    {
+        generator.reader.skip_white_space();
+        if (generator.reader.peek() != '{')
+            generator.reader.fail("The root of the document has to be an object.");
+
+        generator.generate_value(0);
+
+        generator.reader.skip_white_space();
+        if (!generator.reader.is_end())
+            generator.reader.fail("Unexpected characters after the document.");
+    }
+    catch (const JsonReader::FailureResult &failure)
+    {
+        std::cerr << input_path << ":" << failure.line << ":" << failure.column << ": " << failure.error;
+        if (failure.expected != JsonExpectedTokens::NONE && !failure.error.starts_with("Expected"))
+            std::cerr << " Expected " << describe_json_expected_tokens(failure.expected) << ".";
+        std::cerr << std::endl;
+        return 1;
+    }
+
+    std::ofstream header{std::string{header_path}};
+    header << "#pragma once\n\n"
+           << "#include \"compile_time_json/compile_time_json.hpp\"\n\n"
+           << "// Generated by json_struct_generator from " << input_path << ", do not edit.\n\n"
+           << "using " << type_name << " = " << generator.type << ";\n\n"
+           << "extern const " << type_name << " " << variable_name << ";\n";
+
+    std::ofstream source{std::string{source_path}};
+    source << "#include \"" << header_include << "\"\n\n"
+           << "// Generated by json_struct_generator from " << input_path << ", do not edit.\n\n"
+           << "const " << type_name << " " << variable_name << " = R\"" << RawStringDelimiter << "(" << input << ")" << RawStringDelimiter << "\"_json;\n";
+
+    return header && source ? 0 : 1;
+}
@@ -0,0 +1,46 @@
+load("@rules_cc//cc:defs.bzl", "cc_library")
+
+def json_struct_library(name, src, type_name, variable_name, **kwargs):
+    """Generates a cc_library for the Json type of a JSON file and a constant holding its contents.
+
+    The generated header `<name>.hpp` declares `using <type_name> = Json<...>;` with the type spelled out, so including it
+    does not run the compile time parser, and `extern const <type_name> <variable_name>;`. The constant is defined in
+    `<name>.cc` from the `_json` literal, which is the only translation unit parsing the file and which fails to compile if
+    the generated type doesn't match the literal.
+
+    Args:
+      name: Name of the cc_library and of the generated files.
+      src: The JSON file.
+      type_name: Name of the generated type alias.
+      variable_name: Name of the generated constant.
+      **kwargs: Forwarded to the cc_library.
+    """
+    header = name + ".hpp"
+    source = name + ".cc"
+    package = native.package_name()
+    header_include = package + "/" + header if package else header
+    generator = Label("//compile_time_json:json_struct_generator")
+
+    native.genrule(
+        name = name + "_generate",
+        srcs = [src],
+        outs = [header, source],
+        cmd = "$(execpath {generator}) $(location {src}) $(location {header}) $(location {source}) {header_include} {type_name} {variable_name}".format(
+            generator = generator,
+            src = src,
+            header = header,
+            source = source,
+            header_include = header_include,
+            type_name = type_name,
+            variable_name = variable_name,
+        ),
+        tools = [generator],
+    )
+
+    cc_library(
+        name = name,
+        hdrs = [header],
+        srcs = [source],
+        deps = [Label("//compile_time_json:compile_time_json")],
+        **kwargs
+    )
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "compile_time_json/compile_time_json.hpp"
+#include "compile_time_json/json_reader.hpp"
+
+#include <bitset>
+#include <limits>
+
+// Read only view over a runtime JSON buffer shaped like a _json schema that decodes members on first access. Members in front of the
+// requested one are skipped without decoding and their positions are cached, so the parse cost follows the members actually touched.
+// The buffer has to outlive the view.
+template <typename Schema>
+struct LazyJsonView
+{
+    static_assert(Schema::JsonType == JsonValueType::OBJECT, "A lazy view can only be created over an object schema.");
+
+    static constexpr std::size_t MemberCount = Schema::MemberNames.size();
+    static constexpr std::size_t UnknownPosition = std::numeric_limits<std::size_t>::max();
+
+    explicit LazyJsonView(const std::string_view i_buffer, JsonStringPool *const i_string_pool = nullptr) : buffer(i_buffer), string_pool(i_string_pool)
+    {
+        value_positions.fill(UnknownPosition);
+    }
+
+    template <auto Name>
+    const auto &get() const
+    {
+        constexpr auto Index = Schema::template member_index<Name.Value>;
+        static_assert(Index != MemberCount, "The member is not part of the schema.");
+
+        auto &member = values.template get<Name>();
+        if (!decoded_members[Index])
+        {
+            JsonReader reader{buffer, find_value_position(Index), string_pool};
+            reader.read_value(member);
+            decoded_members[Index] = true;
+        }
+
+        return member;
+    }
+
+    template <FixedLengthString Name>
+    const auto &operator[](const CompileTimeValueHolder<Name> &) const
+    {
+        return get<CompileTimeValueHolder<Name>{}>();
+    }
+
+private:
+    // Scans forward from where the previous lookup stopped, caching the value position of every schema member passed on the way.
+    std::size_t find_value_position(const std::size_t index) const
+    {
+        if (value_positions[index] != UnknownPosition)
+            return value_positions[index];
+
+        JsonReader reader{buffer, scan_position};
+        if (!is_scan_started)
+        {
+            reader.skip_white_space();
+            reader.expect('{', "Expected '{'.");
+            is_scan_started = true;
+        }
+
+        while (true)
+        {
+            reader.skip_white_space();
+            if (reader.peek() == '}')
+                reader.fail("The member is missing from the input.");
+
+            const auto name = reader.read_string_token();
+            reader.skip_white_space();
+            reader.expect(':', "Expected ':' after the member name.");
+            reader.skip_white_space();
+
+            const auto member_index = Schema::find_member_index(name);
+            if (member_index != MemberCount && value_positions[member_index] == UnknownPosition)
+                value_positions[member_index] = reader.position;
+
+            reader.skip_value();
+            reader.skip_white_space();
+            if (reader.peek() == ',')
+                reader.position++;
+            else if (reader.peek() != '}')
+                reader.fail("Expected ',' or '}'.", reader.position, JsonExpectedTokens::COMMA | JsonExpectedTokens::OBJECT_END);
+            scan_position = reader.position;
+
+            if (member_index == index)
+                return value_positions[index];
+        }
+    }
+
+    std::string_view buffer;
+    JsonStringPool *string_pool;
+    mutable Schema values{};
+    mutable std::array<std::size_t, MemberCount> value_positions;
+    mutable std::bitset<MemberCount> decoded_members;
+    mutable std::size_t scan_position{0};
+    mutable bool is_scan_started{false};
+};
@@ -0,0 +1,208 @@
+#pragma once
+
+#include "compile_time_json/compile_time_json.hpp"
+
+#include <new>
+
+struct JsonLeafDescriptor
+{
+    std::string_view path;
+    JsonValueType type;
+    std::size_t offset;
+    std::size_t size;
+    bool is_pooled_string{false};
+};
+
+constexpr void append_json_path_index(std::string &path, const std::size_t index)
+{
+    const auto digits_begin = path.size();
+    std::size_t remaining = index;
+    do
+    {
+        path.push_back(static_cast<char>('0' + remaining % 10));
+        remaining /= 10;
+    } while (remaining);
+    std::reverse(path.begin() + digits_begin, path.end());
+}
+
+// Walks the leaf types of a schema depth first in member order, calling the visitor with the JSON pointer of each leaf and its type.
+template <typename Value, typename Visitor>
+constexpr void for_each_json_leaf_type(std::string &path, Visitor &visitor)
+{
+    if constexpr (Value::JsonType == JsonValueType::OBJECT)
+        [&]<typename... Members>(const Json<Members...> *) {
+            ((path.append("/").append(Members::Key),
+              for_each_json_leaf_type<decltype(Members::value)>(path, visitor),
+              path.resize(path.size() - Members::Key.size() - 1)),
+             ...);
+        }(static_cast<const Value *>(nullptr));
+    else if constexpr (is_uniform_json_array<Value>)
+        for (std::size_t index = 0; index < Value::Size; index++)
+        {
+            path.push_back('/');
+            append_json_path_index(path, index);
+            for_each_json_leaf_type<typename Value::ElementType>(path, visitor);
+            path.resize(path.rfind('/'));
+        }
+    else if constexpr (Value::JsonType == JsonValueType::ARRAY)
+        [&]<typename... Members>(const Array<Members...> *) {
+            ((path.push_back('/'),
+              append_json_path_index(path, Members::Index),
+              for_each_json_leaf_type<decltype(Members::value)>(path, visitor),
+              path.resize(path.rfind('/'))),
+             ...);
+        }(static_cast<const Value *>(nullptr));
+    else
+        visitor(std::as_const(path), std::type_identity<Value>{});
+}
+
+// Runtime counterpart of for_each_json_leaf_type, calls the visitor with every leaf member of an object in the same order.
+template <typename Value, typename Visitor>
+constexpr void for_each_json_leaf(Value &value, Visitor &visitor)
+{
+    using ValueType = std::remove_const_t<Value>;
+
+    if constexpr (ValueType::JsonType == JsonValueType::OBJECT)
+        [&]<typename... Members>(const Json<Members...> *) {
+            (for_each_json_leaf(static_cast<std::conditional_t<std::is_const_v<Value>, const Members, Members> &>(value).value, visitor), ...);
+        }(static_cast<const ValueType *>(nullptr));
+    else if constexpr (is_uniform_json_array<ValueType>)
+        for (auto &element : value.elements)
+            for_each_json_leaf(element, visitor);
+    else if constexpr (ValueType::JsonType == JsonValueType::ARRAY)
+        [&]<typename... Members>(const Array<Members...> *) {
+            (for_each_json_leaf(static_cast<std::conditional_t<std::is_const_v<Value>, const Members, Members> &>(value).value, visitor), ...);
+        }(static_cast<const ValueType *>(nullptr));
+    else
+        visitor(value);
+}
+
+// Flat table of every leaf of a schema, so bulk operations can loop over the leaves instead of instantiating recursive visitors.
+template <typename Value>
+struct JsonLeafTable
+{
+    static constexpr std::size_t LeafCount = [] {
+        std::size_t leaf_count = 0;
+        std::string path;
+        auto visitor = [&](const std::string &, auto) { leaf_count++; };
+        for_each_json_leaf_type<Value>(path, visitor);
+        return leaf_count;
+    }();
+
+    static constexpr std::size_t PathCharacterCount = [] {
+        std::size_t character_count = 0;
+        std::string path;
+        auto visitor = [&](const std::string &leaf_path, auto) { character_count += leaf_path.size(); };
+        for_each_json_leaf_type<Value>(path, visitor);
+        return character_count;
+    }();
+
+    static constexpr auto PathCharacters = [] {
+        std::array<char, PathCharacterCount> characters{};
+        auto next_character = characters.begin();
+        std::string path;
+        auto visitor = [&](const std::string &leaf_path, auto) { next_character = std::ranges::copy(leaf_path, next_character).out; };
+        for_each_json_leaf_type<Value>(path, visitor);
+        return characters;
+    }();
+
+    static constexpr std::array<std::string_view, LeafCount> Paths = [] {
+        std::array<std::string_view, LeafCount> paths{};
+        std::size_t leaf_index = 0;
+        std::size_t path_begin = 0;
+        std::string path;
+        auto visitor = [&](const std::string &leaf_path, auto) {
+            paths[leaf_index++] = std::string_view{PathCharacters.data() + path_begin, leaf_path.size()};
+            path_begin += leaf_path.size();
+        };
+        for_each_json_leaf_type<Value>(path, visitor);
+        return paths;
+    }();
+
+    static constexpr std::array<JsonValueType, LeafCount> Types = [] {
+        std::array<JsonValueType, LeafCount> types{};
+        std::size_t leaf_index = 0;
+        std::string path;
+        auto visitor = [&]<typename Leaf>(const std::string &, std::type_identity<Leaf>) { types[leaf_index++] = Leaf::JsonType; };
+        for_each_json_leaf_type<Value>(path, visitor);
+        return types;
+    }();
+
+    // Returns the index of the leaf with the given JSON pointer or LeafCount if there is none.
+    static constexpr std::size_t find_leaf_index(const std::string_view path) noexcept
+    {
+        return std::ranges::find(Paths, path) - Paths.begin();
+    }
+
+    // Descriptors with byte offsets relative to the start of the object. The generated types are not standard-layout so the offsets
+    // can't be constant expressions, they are measured once on a default constructed object instead.
+    static const std::array<JsonLeafDescriptor, LeafCount> &leaves()
+    {
+        static const auto descriptors = [] {
+            const Value probe{};
+            std::array<JsonLeafDescriptor, LeafCount> descriptors{};
+            std::size_t leaf_index = 0;
+            auto visitor = [&](const auto &leaf) {
+                const auto offset = reinterpret_cast<const char *>(&leaf.value) - reinterpret_cast<const char *>(&probe);
+                descriptors[leaf_index] = {Paths[leaf_index], Types[leaf_index], static_cast<std::size_t>(offset), sizeof(leaf.value), std::is_same_v<std::remove_cvref_t<decltype(leaf)>, PooledStringMember>};
+                leaf_index++;
+            };
+            for_each_json_leaf(probe, visitor);
+            return descriptors;
+        }();
+
+        return descriptors;
+    }
+};
+
+template <typename LeafMember, typename Value>
+auto &json_leaf_member_value(Value &object, const JsonLeafDescriptor &leaf)
+{
+    using LeafValue = std::conditional_t<std::is_const_v<Value>, const decltype(LeafMember::value), decltype(LeafMember::value)>;
+    using Byte = std::conditional_t<std::is_const_v<Value>, const char, char>;
+
+    return *std::launder(reinterpret_cast<LeafValue *>(reinterpret_cast<Byte *>(&object) + leaf.offset));
+}
+
+// Returns the value of the leaf described by the descriptor, which has to come from the leaf table of the object type.
+template <JsonValueType Type, typename Value>
+auto &json_leaf_value(Value &object, const JsonLeafDescriptor &leaf)
+{
+    if (leaf.type != Type | leaf.is_pooled_string)
+        throw "InvalidLeafAccess";
+
+    return json_leaf_member_value<Member<Type>>(object, leaf);
+}
+
+// Returns the view held by a pooled string leaf.
+template <typename Value>
+auto &json_pooled_string_leaf_value(Value &object, const JsonLeafDescriptor &leaf)
+{
+    if (!leaf.is_pooled_string)
+        throw "InvalidLeafAccess";
+
+    return json_leaf_member_value<PooledStringMember>(object, leaf);
+}
+
+// Calls the visitor with the typed value of the leaf described by the descriptor.
+template <typename Value, typename Visitor>
+decltype(auto) visit_json_leaf(Value &object, const JsonLeafDescriptor &leaf, Visitor &&visitor)
+{
+    switch (leaf.type)
+    {
+    case JsonValueType::BOOL:
+        return visitor(json_leaf_value<JsonValueType::BOOL>(object, leaf));
+    case JsonValueType::SIGNED_INTEGER:
+        return visitor(json_leaf_value<JsonValueType::SIGNED_INTEGER>(object, leaf));
+    case JsonValueType::UNSIGNED_INTEGER:
+        return visitor(json_leaf_value<JsonValueType::UNSIGNED_INTEGER>(object, leaf));
+    case JsonValueType::DOUBLE:
+        return visitor(json_leaf_value<JsonValueType::DOUBLE>(object, leaf));
+    case JsonValueType::STRING:
+        if (leaf.is_pooled_string)
+            return visitor(json_pooled_string_leaf_value(object, leaf));
+        return visitor(json_leaf_value<JsonValueType::STRING>(object, leaf));
+    default:
+        return visitor(json_leaf_value<JsonValueType::NULL_VALUE>(object, leaf));
+    }
+}
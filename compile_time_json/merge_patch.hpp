@@ -0,0 +1,83 @@
+#pragma once
+
+#include "compile_time_json/compile_time_json.hpp"
+#include "compile_time_json/json_reader.hpp"
+#include "compile_time_json/leaf_table.hpp"
+
+#include <string>
+#include <vector>
+
+template <typename Value>
+void apply_merge_patch_impl(JsonReader &reader, Value &target, std::string &path, std::vector<std::string> &unknown_members)
+{
+    if constexpr (Value::JsonType != JsonValueType::NULL_VALUE)
+        if (const auto value_position = reader.position; reader.read_literal("null"))
+            reader.fail("Members of the schema can not be removed by a patch.", value_position);
+
+    if constexpr (Value::JsonType == JsonValueType::OBJECT)
+        reader.read_object([&](const std::string_view name) {
+            const auto parent_path_size = path.size();
+            path.push_back('/');
+            for (const char c : name)
+            {
+                if (c == '~')
+                    path.append("~0");
+                else if (c == '/')
+                    path.append("~1");
+                else
+                    path.push_back(c);
+            }
+
+            if (!target.visit_member(Value::find_member_index(name), [&](auto &member) { apply_merge_patch_impl(reader, member, path, unknown_members); }))
+            {
+                unknown_members.push_back(path);
+                reader.skip_value();
+            }
+
+            path.resize(parent_path_size);
+        });
+    else if constexpr (Value::JsonType == JsonValueType::ARRAY)
+    {
+        // Walked here rather than by JsonReader::read_value, so unknown members of object elements are reported too.
+        const auto begin = reader.position;
+        const auto element_count = reader.read_array([&](const std::size_t index) {
+            const auto parent_path_size = path.size();
+            path.push_back('/');
+            append_json_path_index(path, index);
+
+            if (!target.visit_element(index, [&](auto &element) { apply_merge_patch_impl(reader, element, path, unknown_members); }))
+                reader.fail("The array has more elements than the schema.");
+
+            path.resize(parent_path_size);
+        });
+
+        if (element_count != Value::Size)
+            reader.fail("The array has fewer elements than the schema.", begin);
+    }
+    else
+        reader.read_value(target);
+}
+
+// Applies an RFC 7386 merge patch in place, parsing only the patch. Objects are merged recursively while any other value replaces
+// the matching leaf. Unlike RFC 7386, arrays are not replaced as a whole since their length is part of the schema: they have to
+// match the schema length and object elements are merged into the existing elements, so members missing from them keep their
+// values. Returns the JSON pointers of the patch members that are not part of the schema, their values are skipped. Throws
+// JsonReader::FailureResult on malformed patches or values that do not fit the schema, in which case the members before the
+// failure are already patched.
+template <typename Value>
+std::vector<std::string> apply_merge_patch(Value &target, const std::string_view patch, JsonStringPool *const string_pool = nullptr)
+{
+    static_assert(Value::JsonType == JsonValueType::OBJECT, "A merge patch can only be applied to an object.");
+
+    std::vector<std::string> unknown_members;
+    std::string path;
+    JsonReader reader{patch, 0, string_pool};
+
+    apply_merge_patch_impl(reader, target, path, unknown_members);
+
+    reader.skip_white_space();
+    if (!reader.is_end())
+        reader.fail("Unexpected characters after the patch.");
+
+    return unknown_members;
+}
@@ -0,0 +1,192 @@
+#pragma once
+
+#include "compile_time_json/compile_time_json.hpp"
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+template <FixedLengthString Name>
+constexpr auto json_member_path()
+{
+    std::array<char, Name.string.size() + 2> path{'/'};
+    std::ranges::copy(Name.string, path.begin() + 1);
+    return FixedLengthString<path.size()>(path.data());
+}
+
+// Projection selectors are either members ("a"_member) or paths ("/b/c"_path), members are turned into single segment paths.
+template <typename Selector>
+struct JsonProjectionPath;
+
+template <FixedLengthString Path>
+struct JsonProjectionPath<JsonPath<Path>>
+{
+    using Type = JsonPath<Path>;
+};
+
+template <FixedLengthString Name>
+struct JsonProjectionPath<CompileTimeValueHolder<Name>>
+{
+    using Type = JsonPath<json_member_path<Name>()>;
+};
+
+template <typename Path, auto Name, typename Value>
+constexpr bool is_json_projection_step(const NamedValue<Name, Value> *)
+{
+    return Path::Segment == NamedValue<Name, Value>::Key;
+}
+
+template <typename Path, std::size_t Index, typename Value>
+constexpr bool is_json_projection_step(const IndexedValue<Index, Value> *)
+{
+    return Path::is_array_index() && Path::array_index() == Index;
+}
+
+template <typename Member, typename Value>
+struct JsonProjectionMember;
+
+template <auto Name, typename OriginalValue, typename Value>
+struct JsonProjectionMember<NamedValue<Name, OriginalValue>, Value>
+{
+    using Type = NamedValue<Name, Value>;
+};
+
+template <std::size_t Index, typename OriginalValue, typename Value>
+struct JsonProjectionMember<IndexedValue<Index, OriginalValue>, Value>
+{
+    using Type = IndexedValue<Index, Value>;
+};
+
+template <template <typename...> typename Destination, typename Members>
+struct JsonProjectionRebind;
+
+template <template <typename...> typename Destination, typename... Members>
+struct JsonProjectionRebind<Destination, std::tuple<Members...>>
+{
+    using Type = Destination<Members...>;
+};
+
+// Type holding only the selected leaves of Value, nested the same way as Value so the accessors keep working. Paths is a tuple of
+// JsonPath types positioned at the level of Value.
+template <typename Value, typename Paths>
+struct JsonProjection;
+
+template <typename Value, typename... Paths>
+struct JsonProjection<Value, std::tuple<Paths...>>
+{
+    template <typename Member>
+    static constexpr bool IsSelected = (is_json_projection_step<Paths>(static_cast<const Member *>(nullptr)) || ...);
+
+    template <typename Member>
+    using NextPaths = decltype(std::tuple_cat(std::declval<std::conditional_t<is_json_projection_step<Paths>(static_cast<const Member *>(nullptr)), std::tuple<typename Paths::Next>, std::tuple<>>>()...));
+
+    // Only the selected members are projected further, so the subtrees that are left out are never instantiated.
+    template <typename Member>
+    static constexpr auto project_member()
+    {
+        if constexpr (IsSelected<Member>)
+            return std::type_identity<std::tuple<typename JsonProjectionMember<Member, typename JsonProjection<decltype(Member::value), NextPaths<Member>>::Type>::Type>>{};
+        else
+            return std::type_identity<std::tuple<>>{};
+    }
+
+    template <typename Member>
+    using ProjectedMembers = typename decltype(project_member<Member>())::type;
+
+    // Distinct element indices of the paths in ascending order and their count, only used when Value is a uniform array.
+    static constexpr auto SelectedIndices = [] {
+        std::array<std::size_t, sizeof...(Paths)> indices{Paths::array_index()...};
+        std::ranges::sort(indices);
+        const auto unique_end = std::ranges::unique(indices).begin();
+        return std::pair{indices, static_cast<std::size_t>(unique_end - indices.begin())};
+    }();
+
+    static constexpr auto select_type()
+    {
+        if constexpr ((Paths::IsEnd || ...))
+            return std::type_identity<Value>{};
+        else if constexpr (Value::JsonType == JsonValueType::OBJECT)
+        {
+            static_assert(((Value::find_member_index(Paths::Segment) != Value::MemberNames.size()) && ...), "The projection refers to a member that is not part of the schema.");
+
+            return []<typename... Members>(const Json<Members...> *) {
+                return std::type_identity<typename JsonProjectionRebind<Json, decltype(std::tuple_cat(std::declval<ProjectedMembers<Members>>()...))>::Type>{};
+            }(static_cast<const Value *>(nullptr));
+        }
+        else if constexpr (Value::JsonType == JsonValueType::ARRAY)
+        {
+            static_assert(((Paths::is_array_index() && std::ranges::find(Value::ElementIndices, Paths::array_index()) != Value::ElementIndices.end()) && ...), "The projection refers to an array element that is out of range.");
+
+            // Selected elements of a uniform array are projected like the elements of a sparse array, the others are not visited.
+            if constexpr (is_uniform_json_array<Value>)
+                return []<std::size_t... Positions>(const std::index_sequence<Positions...> &) {
+                    return std::type_identity<typename JsonProjectionRebind<Array, decltype(std::tuple_cat(std::declval<ProjectedMembers<IndexedValue<SelectedIndices.first[Positions], typename Value::ElementType>>>()...))>::Type>{};
+                }(std::make_index_sequence<SelectedIndices.second>());
+            else
+                return []<typename... Members>(const Array<Members...> *) {
+                    return std::type_identity<typename JsonProjectionRebind<Array, decltype(std::tuple_cat(std::declval<ProjectedMembers<Members>>()...))>::Type>{};
+                }(static_cast<const Value *>(nullptr));
+        }
+        else
+        {
+            static_assert(sizeof...(Paths) == 0, "The projection continues past a leaf value.");
+            return std::type_identity<Value>{};
+        }
+    }
+
+    using Type = typename decltype(select_type())::type;
+};
+
+template <typename Value, auto... Selectors>
+using JsonProjectionType = typename JsonProjection<Value, std::tuple<typename JsonProjectionPath<std::remove_const_t<decltype(Selectors)>>::Type...>>::Type;
+
+// Copies every leaf of the projection from or to the full object, direction is chosen by which side is const.
+template <typename Projected, typename Full>
+constexpr void copy_json_projection(Projected &projected, Full &full)
+{
+    using ProjectedType = std::remove_const_t<Projected>;
+    using FullType = std::remove_const_t<Full>;
+
+    if constexpr (std::is_same_v<ProjectedType, FullType>)
+    {
+        if constexpr (std::is_const_v<Full>)
+            projected = full;
+        else
+            full = projected;
+    }
+    else if constexpr (ProjectedType::JsonType == JsonValueType::OBJECT)
+        [&]<typename... Members>(const Json<Members...> *) {
+            (copy_json_projection(static_cast<std::conditional_t<std::is_const_v<Projected>, const Members, Members> &>(projected).value,
+                                  full.template get_member<FullType::find_member_index(Members::Key)>()),
+             ...);
+        }(static_cast<const ProjectedType *>(nullptr));
+    else
+        [&]<typename... Members>(const Array<Members...> *) {
+            (copy_json_projection(static_cast<std::conditional_t<std::is_const_v<Projected>, const Members, Members> &>(projected).value,
+                                  full.template get<Members::Index>()),
+             ...);
+        }(static_cast<const ProjectedType *>(nullptr));
+}
+
+// Returns a tightly packed copy of the selected members and paths, keeping the nesting and accessors of the full object.
+template <auto... Selectors, typename Value>
+constexpr auto project(const Value &full)
+{
+    JsonProjectionType<Value, Selectors...> projected;
+    copy_json_projection(projected, full);
+    return projected;
+}
+
+// Refreshes a projection from the full object without constructing a new one.
+template <typename Projected, typename Value>
+constexpr void copy_to_projection(const Value &full, Projected &projected)
+{
+    copy_json_projection(projected, full);
+}
+
+// Writes the leaves of a projection back into the full object.
+template <typename Projected, typename Value>
+constexpr void write_back_projection(const Projected &projected, Value &full)
+{
+    copy_json_projection(projected, full);
+}
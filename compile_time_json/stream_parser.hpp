@@ -0,0 +1,489 @@
+#pragma once
+
+#include "compile_time_json/compile_time_json.hpp"
+#include "compile_time_json/json_reader.hpp"
+#include "compile_time_json/leaf_table.hpp"
+
+#include <algorithm>
+#include <span>
+#include <string>
+
+// Flattened form of a schema for parsers that keep their own stack. Nodes are numbered depth first in member order, so leaves are
+// numbered like in JsonLeafTable.
+struct JsonStreamNode
+{
+    JsonValueType type = JsonValueType::NULL_VALUE;
+    std::size_t child_begin{0};
+    std::size_t child_count{0};
+    std::size_t leaf_index{0};
+    std::size_t (*find_member_index)(std::string_view) noexcept = nullptr;
+};
+
+template <std::size_t NodeCount>
+struct JsonStreamNodeTable
+{
+    std::array<JsonStreamNode, NodeCount> nodes{};
+    std::array<std::size_t, NodeCount> children{};
+    std::size_t node_count{0};
+    std::size_t child_count{0};
+    std::size_t leaf_count{0};
+};
+
+template <typename Value>
+constexpr std::size_t json_stream_node_count()
+{
+    if constexpr (Value::JsonType == JsonValueType::OBJECT)
+        return []<typename... Members>(const Json<Members...> *) { return (json_stream_node_count<decltype(Members::value)>() + ... + 1); }(static_cast<const Value *>(nullptr));
+    else if constexpr (is_uniform_json_array<Value>)
+        return Value::Size * json_stream_node_count<typename Value::ElementType>() + 1;
+    else if constexpr (Value::JsonType == JsonValueType::ARRAY)
+        return []<typename... Members>(const Array<Members...> *) { return (json_stream_node_count<decltype(Members::value)>() + ... + 1); }(static_cast<const Value *>(nullptr));
+    else
+        return 1;
+}
+
+template <typename Value>
+constexpr std::size_t json_stream_container_depth()
+{
+    if constexpr (Value::JsonType == JsonValueType::OBJECT)
+        return []<typename... Members>(const Json<Members...> *) { return std::max({std::size_t{0}, json_stream_container_depth<decltype(Members::value)>()...}) + 1; }(static_cast<const Value *>(nullptr));
+    else if constexpr (is_uniform_json_array<Value>)
+        return json_stream_container_depth<typename Value::ElementType>() + 1;
+    else if constexpr (Value::JsonType == JsonValueType::ARRAY)
+        return []<typename... Members>(const Array<Members...> *) { return std::max({std::size_t{0}, json_stream_container_depth<decltype(Members::value)>()...}) + 1; }(static_cast<const Value *>(nullptr));
+    else
+        return 0;
+}
+
+template <typename Value, typename Table>
+constexpr std::size_t add_json_stream_node(Table &table)
+{
+    const auto node = table.node_count++;
+    table.nodes[node].type = Value::JsonType;
+
+    const auto add_children = [&]<typename... Members>() {
+        const auto child_begin = table.child_count;
+        table.child_count += sizeof...(Members);
+        table.nodes[node].child_begin = child_begin;
+        table.nodes[node].child_count = sizeof...(Members);
+
+        std::size_t position = 0;
+        ((table.children[child_begin + position++] = add_json_stream_node<decltype(Members::value)>(table)), ...);
+    };
+
+    if constexpr (Value::JsonType == JsonValueType::OBJECT)
+    {
+        [&]<typename... Members>(const Json<Members...> *) { add_children.template operator()<Members...>(); }(static_cast<const Value *>(nullptr));
+        table.nodes[node].find_member_index = &Value::find_member_index;
+    }
+    else if constexpr (is_uniform_json_array<Value>)
+        [&]<std::size_t... Indices>(const std::index_sequence<Indices...> &) { add_children.template operator()<IndexedValue<Indices, typename Value::ElementType>...>(); }(std::make_index_sequence<Value::Size>());
+    else if constexpr (Value::JsonType == JsonValueType::ARRAY)
+        [&]<typename... Members>(const Array<Members...> *) { add_children.template operator()<Members...>(); }(static_cast<const Value *>(nullptr));
+    else
+        table.nodes[node].leaf_index = table.leaf_count++;
+
+    return node;
+}
+
+// Push parser filling an object of the schema from input arriving in arbitrary chunks. It keeps an explicit stack bounded by the
+// schema depth instead of recursing, and only buffers the token that is split across chunks. Accepts the same dialect as JsonReader,
+// records may be separated by white space. Members that are missing from a record keep their previous values and members that are
+// not in the schema are skipped.
+template <typename Schema>
+struct JsonStreamParser
+{
+    static_assert(Schema::JsonType == JsonValueType::OBJECT, "A stream parser can only fill an object schema.");
+
+    static constexpr auto Table = [] {
+        JsonStreamNodeTable<json_stream_node_count<Schema>()> table;
+        add_json_stream_node<Schema>(table);
+        return table;
+    }();
+    static constexpr std::size_t MaxDepth = json_stream_container_depth<Schema>();
+    static constexpr std::size_t SkippedNode = Table.nodes.size();
+    static constexpr std::size_t MaxNumberLength = 128;
+
+    enum struct State
+    {
+        BEFORE_RECORD,
+        OBJECT_MEMBER,
+        MEMBER_NAME,
+        MEMBER_COLON,
+        ARRAY_ELEMENT,
+        VALUE,
+        STRING_VALUE,
+        SCALAR_VALUE,
+        SKIPPED_VALUE,
+        AFTER_VALUE,
+        RECORD_READY,
+    };
+
+    struct Frame
+    {
+        std::size_t node;
+        std::size_t element_count;
+    };
+
+    explicit JsonStreamParser(Schema &i_target, JsonStringPool *const i_string_pool = nullptr) : target(i_target), string_pool(i_string_pool)
+    {
+    }
+
+    // Consumes the chunk until it runs out or a record is complete, returns the number of consumed characters. Once a record is
+    // ready the rest of the chunk has to be fed again after next_record(). Throws JsonReader::FailureResult with the offset, line and
+    // column in the whole stream on malformed input.
+    std::size_t feed(const std::span<const char> chunk)
+    {
+        std::size_t index = 0;
+        while (index < chunk.size() && state != State::RECORD_READY)
+        {
+            const auto consumed = process(chunk.subspan(index));
+            for (std::size_t consumed_index = index; consumed_index < index + consumed; consumed_index++)
+                if (chunk[consumed_index] == '\n')
+                {
+                    line++;
+                    line_begin = stream_position + consumed_index - index + 1;
+                }
+            index += consumed;
+            stream_position += consumed;
+        }
+        return index;
+    }
+
+    bool is_record_ready() const noexcept
+    {
+        return state == State::RECORD_READY;
+    }
+
+    // Also starts over after feed threw in the middle of a record, the rest of that record has to be dropped by the caller.
+    void next_record() noexcept
+    {
+        state = State::BEFORE_RECORD;
+        depth = 0;
+        token.clear();
+        skipped_closing_brackets.clear();
+        is_in_escape_state = false;
+        is_in_skipped_string = false;
+    }
+
+    // True while no part of a record has been consumed, so the stream may end here.
+    bool is_between_records() const noexcept
+    {
+        return state == State::BEFORE_RECORD || state == State::RECORD_READY;
+    }
+
+    std::size_t position() const noexcept
+    {
+        return stream_position;
+    }
+
+private:
+    static constexpr bool is_white_space(const char c) noexcept
+    {
+        return c == ' ' | c == '\t' | c == '\n' | c == '\r';
+    }
+
+    [[noreturn]] void fail(const std::string_view error, const std::size_t char_index, const JsonExpectedTokens expected = JsonExpectedTokens::NONE) const
+    {
+        throw JsonReader::FailureResult{error, char_index, line, char_index < line_begin ? 1 : char_index - line_begin + 1, expected};
+    }
+
+    [[noreturn]] void fail(const std::string_view error, const JsonExpectedTokens expected = JsonExpectedTokens::NONE) const
+    {
+        fail(error, stream_position, expected);
+    }
+
+    void push(const std::size_t node)
+    {
+        stack[depth++] = {node, 0};
+        state = Table.nodes[node].type == JsonValueType::OBJECT ? State::OBJECT_MEMBER : State::ARRAY_ELEMENT;
+    }
+
+    void pop()
+    {
+        const auto &frame = stack[depth - 1];
+        if (Table.nodes[frame.node].type == JsonValueType::ARRAY && frame.element_count != Table.nodes[frame.node].child_count)
+            fail("The array has fewer elements than the schema.");
+
+        depth--;
+        state = depth ? State::AFTER_VALUE : State::RECORD_READY;
+    }
+
+    // Appends the string characters at the start of the input up to the closing quote, returns the number of appended characters.
+    // The closing quote is left in the input.
+    std::size_t append_string_characters(const std::span<const char> input)
+    {
+        if (is_in_escape_state)
+        {
+            is_in_escape_state = false;
+            token.push_back(input.front());
+            return 1;
+        }
+        if (input.front() == '\\')
+        {
+            is_in_escape_state = true;
+            token.push_back('\\');
+            return 1;
+        }
+
+        // Copy the plain run of characters at once instead of going through the state machine for each one.
+        const auto run_end = std::ranges::find_if(input, [](const char c) { return c == '"' | c == '\\'; });
+        token.append(input.begin(), run_end);
+        return run_end - input.begin();
+    }
+
+    template <JsonValueType Type>
+    auto &leaf_value(const std::size_t node)
+    {
+        return json_leaf_value<Type>(target, JsonLeafTable<Schema>::leaves()[Table.nodes[node].leaf_index]);
+    }
+
+    void assign_string()
+    {
+        const auto &leaf = JsonLeafTable<Schema>::leaves()[Table.nodes[value_node].leaf_index];
+        if (!leaf.is_pooled_string)
+            json_leaf_value<JsonValueType::STRING>(target, leaf) = unescape_json_string(token);
+        else if (!string_pool)
+            fail("Pooled string members can only be read with a string pool.", token_position);
+        else
+            json_pooled_string_leaf_value(target, leaf) = token.find('\\') == std::string::npos ? string_pool->intern(token) : string_pool->intern(unescape_json_string(token));
+    }
+
+    template <typename Number>
+    void read_number(Number &number)
+    {
+        const auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), number);
+        if (error != std::errc{} || end != token.data() + token.size())
+            fail("The number does not fit the type of the schema member.", token_position);
+    }
+
+    void finish_scalar()
+    {
+        // Mirrors JsonReader::skip_value, which only accepts the literals and number tokens.
+        if (value_node == SkippedNode)
+        {
+            const auto is_number_character = [](const char c) { return (c <= '9' & c >= '0') | c == '-' | c == '+' | c == '.' | c == 'e' | c == 'E'; };
+            if (token != "true" && token != "false" && token != "null" && (token.empty() || !std::ranges::all_of(token, is_number_character)))
+                fail("Expected a value but couldn't find any.", token_position, JsonExpectedTokens::VALUE);
+            return;
+        }
+
+        switch (Table.nodes[value_node].type)
+        {
+        case JsonValueType::BOOL:
+            if (token != "true" && token != "false")
+                fail("Expected a boolean.", token_position, JsonExpectedTokens::LITERAL);
+            leaf_value<JsonValueType::BOOL>(value_node) = token == "true";
+            break;
+        case JsonValueType::NULL_VALUE:
+            if (token != "null")
+                fail("Expected null.", token_position, JsonExpectedTokens::LITERAL);
+            break;
+        case JsonValueType::SIGNED_INTEGER:
+            read_number(leaf_value<JsonValueType::SIGNED_INTEGER>(value_node));
+            break;
+        case JsonValueType::UNSIGNED_INTEGER:
+            read_number(leaf_value<JsonValueType::UNSIGNED_INTEGER>(value_node));
+            break;
+        case JsonValueType::DOUBLE:
+            read_number(leaf_value<JsonValueType::DOUBLE>(value_node));
+            break;
+        default:
+            fail("Expected a value but couldn't find any.", token_position, JsonExpectedTokens::VALUE);
+        }
+    }
+
+    // Handles the characters at the start of the input, returns the number of consumed characters. Nothing is consumed when the
+    // character has to be handled again in the new state.
+    std::size_t process(const std::span<const char> input)
+    {
+        const char c = input.front();
+        switch (state)
+        {
+        case State::BEFORE_RECORD:
+            if (is_white_space(c))
+                return 1;
+            if (c != '{')
+                fail("Expected '{'.", JsonExpectedTokens::OBJECT_BEGIN);
+            push(0);
+            return 1;
+
+        case State::OBJECT_MEMBER:
+            if (is_white_space(c))
+                return 1;
+            if (c == '}')
+            {
+                pop();
+                return 1;
+            }
+            if (c != '"')
+                fail("Expected a string.", JsonExpectedTokens::MEMBER_NAME | JsonExpectedTokens::OBJECT_END);
+            token.clear();
+            state = State::MEMBER_NAME;
+            return 1;
+
+        case State::MEMBER_NAME:
+            if (c == '"' && !is_in_escape_state)
+            {
+                const auto &object_node = Table.nodes[stack[depth - 1].node];
+                const auto member_index = object_node.find_member_index(token);
+                value_node = member_index == object_node.child_count ? SkippedNode : Table.children[object_node.child_begin + member_index];
+                state = State::MEMBER_COLON;
+                return 1;
+            }
+            return append_string_characters(input);
+
+        case State::MEMBER_COLON:
+            if (is_white_space(c))
+                return 1;
+            if (c != ':')
+                fail("Expected ':' after the member name.", JsonExpectedTokens::COLON);
+            state = State::VALUE;
+            return 1;
+
+        case State::ARRAY_ELEMENT:
+        {
+            if (is_white_space(c))
+                return 1;
+            if (c == ']')
+            {
+                pop();
+                return 1;
+            }
+
+            auto &frame = stack[depth - 1];
+            const auto &array_node = Table.nodes[frame.node];
+            if (frame.element_count == array_node.child_count)
+                fail("The array has more elements than the schema.");
+            value_node = Table.children[array_node.child_begin + frame.element_count++];
+            state = State::VALUE;
+            return 0;
+        }
+
+        case State::VALUE:
+            if (is_white_space(c))
+                return 1;
+
+            token.clear();
+            token_position = stream_position;
+
+            // Skipped strings and containers are only scanned, skipped scalars are read like any other scalar and checked.
+            if (value_node == SkippedNode)
+            {
+                state = c == '"' | c == '{' | c == '[' ? State::SKIPPED_VALUE : State::SCALAR_VALUE;
+                return 0;
+            }
+
+            switch (Table.nodes[value_node].type)
+            {
+            case JsonValueType::OBJECT:
+                if (c != '{')
+                    fail("Expected '{'.", JsonExpectedTokens::OBJECT_BEGIN);
+                push(value_node);
+                return 1;
+            case JsonValueType::ARRAY:
+                if (c != '[')
+                    fail("Expected '['.", JsonExpectedTokens::ARRAY_BEGIN);
+                push(value_node);
+                return 1;
+            case JsonValueType::STRING:
+                if (c != '"')
+                    fail("Expected a string.", JsonExpectedTokens::QUOTE);
+                state = State::STRING_VALUE;
+                return 1;
+            default:
+                state = State::SCALAR_VALUE;
+                return 0;
+            }
+
+        case State::STRING_VALUE:
+            if (c == '"' && !is_in_escape_state)
+            {
+                assign_string();
+                state = State::AFTER_VALUE;
+                return 1;
+            }
+            return append_string_characters(input);
+
+        case State::SCALAR_VALUE:
+            if (is_white_space(c) | c == ',' | c == '}' | c == ']')
+            {
+                finish_scalar();
+                state = State::AFTER_VALUE;
+                return 0;
+            }
+            if (token.size() == MaxNumberLength)
+                fail("The value is too long.", token_position);
+            token.push_back(c);
+            return 1;
+
+        case State::SKIPPED_VALUE:
+            if (is_in_skipped_string)
+            {
+                if (is_in_escape_state)
+                    is_in_escape_state = false;
+                else if (c == '\\')
+                    is_in_escape_state = true;
+                else if (c == '"')
+                {
+                    is_in_skipped_string = false;
+                    if (skipped_closing_brackets.empty())
+                        state = State::AFTER_VALUE;
+                }
+                return 1;
+            }
+
+            // Like JsonReader::skip_container, every closing bracket has to match the kind of its opening one.
+            if (c == '"')
+                is_in_skipped_string = true;
+            else if (c == '{')
+                skipped_closing_brackets.push_back('}');
+            else if (c == '[')
+                skipped_closing_brackets.push_back(']');
+            else if (c == '}' | c == ']')
+            {
+                if (c != skipped_closing_brackets.back())
+                    fail("Mismatched closing bracket.", json_expected_token(skipped_closing_brackets.back()));
+                skipped_closing_brackets.pop_back();
+                if (skipped_closing_brackets.empty())
+                    state = State::AFTER_VALUE;
+            }
+            return 1;
+
+        case State::AFTER_VALUE:
+        {
+            if (is_white_space(c))
+                return 1;
+
+            const auto is_object = Table.nodes[stack[depth - 1].node].type == JsonValueType::OBJECT;
+            if (c == ',')
+                state = is_object ? State::OBJECT_MEMBER : State::ARRAY_ELEMENT;
+            else if (c == (is_object ? '}' : ']'))
+                pop();
+            else
+                fail(is_object ? "Expected ',' or '}'." : "Expected ',' or ']'.", JsonExpectedTokens::COMMA | (is_object ? JsonExpectedTokens::OBJECT_END : JsonExpectedTokens::ARRAY_END));
+            return 1;
+        }
+
+        default:
+            return 0;
+        }
+    }
+
+    Schema &target;
+    JsonStringPool *string_pool;
+    State state{State::BEFORE_RECORD};
+    std::array<Frame, MaxDepth> stack{};
+    std::size_t depth{0};
+    std::size_t value_node{0};
+    std::string token;
+    std::size_t token_position{0};
+    std::size_t stream_position{0};
+    // Line breaks are counted in everything consumed, including the raw ones copied with string values, so the diagnostics report
+    // the same line and column as JsonReader without keeping earlier chunks.
+    std::size_t line{1};
+    std::size_t line_begin{0};
+    std::string skipped_closing_brackets;
+    bool is_in_escape_state{false};
+    bool is_in_skipped_string{false};
+};
@@ -0,0 +1,209 @@
+#pragma once
+
+#include "compile_time_json/leaf_table.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <string>
+
+// First leaf and leaf count of the value at the JSON pointer, relative to the first leaf of Value. The leaves of a value are the
+// consecutive leaf table entries at or below its pointer, which also holds for the elements of sparse arrays.
+template <typename Value>
+constexpr std::pair<std::size_t, std::size_t> json_pointer_leaf_range(const std::string_view pointer)
+{
+    const auto is_at_or_below_pointer = [&](const std::string_view leaf_path) {
+        return leaf_path.starts_with(pointer) && (leaf_path.size() == pointer.size() || leaf_path[pointer.size()] == '/');
+    };
+
+    const auto &paths = JsonLeafTable<Value>::Paths;
+    const auto begin = std::ranges::find_if(paths, is_at_or_below_pointer);
+    const auto end = std::find_if_not(begin, paths.end(), is_at_or_below_pointer);
+    return {static_cast<std::size_t>(begin - paths.begin()), static_cast<std::size_t>(end - begin)};
+}
+
+// Pointer to a direct member by name, or to a direct element by its index in the array rather than its position.
+template <auto Selector>
+constexpr std::string json_member_pointer(const std::string_view name)
+{
+    std::string pointer{"/"};
+    if constexpr (std::is_integral_v<decltype(Selector)>)
+        append_json_path_index(pointer, Selector);
+    else
+        pointer.append(name);
+    return pointer;
+}
+
+// Leaf range of the value the path refers to, the path is checked against the schema by resolve_json_path.
+template <typename Path, typename Value>
+constexpr std::pair<std::size_t, std::size_t> json_path_leaf_range()
+{
+    using Target = std::remove_cvref_t<decltype(resolve_json_path<Path>(std::declval<Value &>()))>;
+
+    constexpr auto Range = json_pointer_leaf_range<Value>(Path::Pointer);
+    static_assert(Range.second == JsonLeafTable<Target>::LeafCount, "The leaves of the path don't match the leaf table.");
+    return Range;
+}
+
+// Non-const access to a tracked value. Objects and arrays are returned as views of the same root, leaves are marked as changed when
+// they are handed out, as the reference may be written through at any point after that.
+template <typename Value, std::size_t LeafCount>
+struct TrackedJsonView
+{
+    Value &value;
+    std::bitset<LeafCount> &dirty;
+    std::size_t leaf_begin;
+
+    template <typename Child>
+    constexpr decltype(auto) track(Child &child, const std::size_t child_leaf_begin) const
+    {
+        if constexpr (Child::JsonType == JsonValueType::OBJECT | Child::JsonType == JsonValueType::ARRAY)
+            return TrackedJsonView<Child, LeafCount>{child, dirty, child_leaf_begin};
+        else
+        {
+            dirty.set(child_leaf_begin);
+            return (child);
+        }
+    }
+
+    // Takes a member ("a"_member) for objects and an element index for arrays, like the accessors of the schema types.
+    template <auto Selector>
+    constexpr decltype(auto) get() const
+    {
+        if constexpr (std::is_integral_v<decltype(Selector)>)
+        {
+            constexpr auto Range = json_pointer_leaf_range<Value>(json_member_pointer<Selector>({}));
+            return track(value.template get<Selector>(), leaf_begin + Range.first);
+        }
+        else
+        {
+            constexpr auto Index = Value::template member_index<Selector.Value>;
+            static_assert(Index != Value::MemberNames.size(), "The member is not part of the schema.");
+
+            constexpr auto Range = json_pointer_leaf_range<Value>(json_member_pointer<Selector>(Value::MemberNames[Index]));
+            return track(value.template get_member<Index>(), leaf_begin + Range.first);
+        }
+    }
+
+    template <FixedLengthString Name>
+    constexpr decltype(auto) operator[](const CompileTimeValueHolder<Name> &) const
+    {
+        return get<CompileTimeValueHolder<Name>{}>();
+    }
+
+    constexpr decltype(auto) operator[](const std::size_t index) const
+    {
+        static_assert(is_uniform_json_array<Value>, "Only arrays of same shaped elements can be indexed at runtime.");
+        return track(value[index], leaf_begin + index * JsonLeafTable<typename Value::ElementType>::LeafCount);
+    }
+
+    template <FixedLengthString Path>
+    constexpr decltype(auto) operator[](const JsonPath<Path> &) const
+    {
+        constexpr auto Range = json_path_leaf_range<JsonPath<Path>, Value>();
+        return track(resolve_json_path<JsonPath<Path>>(value), leaf_begin + Range.first);
+    }
+
+    static constexpr std::size_t size() noexcept
+    {
+        return Value::Size;
+    }
+
+    // Replaces the whole value and marks all of its leaves as changed.
+    constexpr void assign(const Value &new_value) const
+    {
+        value = new_value;
+        for (std::size_t leaf_index = 0; leaf_index < JsonLeafTable<Value>::LeafCount; leaf_index++)
+            dirty.set(leaf_begin + leaf_index);
+    }
+
+    constexpr const Value &get_value() const noexcept
+    {
+        return value;
+    }
+};
+
+// Opt-in wrapper that records which leaves were written, in a bitset with one bit per leaf of the schema. Writes go through the same
+// get/operator[] accessors as on the schema itself, const access and the plain schema types are not affected.
+template <typename Value>
+struct TrackedJson
+{
+    static constexpr std::size_t LeafCount = JsonLeafTable<Value>::LeafCount;
+
+    constexpr TrackedJson() noexcept = default;
+
+    constexpr explicit TrackedJson(const Value &i_value) : value(i_value)
+    {
+    }
+
+    constexpr TrackedJsonView<Value, LeafCount> view() noexcept
+    {
+        return {value, dirty, 0};
+    }
+
+    template <auto Selector>
+    constexpr decltype(auto) get()
+    {
+        return view().template get<Selector>();
+    }
+
+    template <auto Selector>
+    constexpr decltype(auto) get() const
+    {
+        return value.template get<Selector>();
+    }
+
+    template <typename Selector>
+    constexpr decltype(auto) operator[](const Selector &selector)
+    {
+        return view()[selector];
+    }
+
+    template <typename Selector>
+    constexpr decltype(auto) operator[](const Selector &selector) const
+    {
+        return value[selector];
+    }
+
+    constexpr const Value &get_value() const noexcept
+    {
+        return value;
+    }
+
+    // Returns whether any leaf at or below the JSON pointer was written since the last clear_dirty.
+    template <FixedLengthString Path>
+    constexpr bool changed() const
+    {
+        constexpr auto Range = json_path_leaf_range<JsonPath<Path>, Value>();
+        for (std::size_t leaf_index = Range.first; leaf_index < Range.first + Range.second; leaf_index++)
+            if (dirty.test(leaf_index))
+                return true;
+        return false;
+    }
+
+    // Calls the visitor with the leaf table descriptor of every changed leaf, in leaf table order.
+    template <typename Visitor>
+    void for_each_changed(Visitor &&visitor) const
+    {
+        if (dirty.none())
+            return;
+
+        const auto &leaves = JsonLeafTable<Value>::leaves();
+        for (std::size_t leaf_index = 0; leaf_index < LeafCount; leaf_index++)
+            if (dirty.test(leaf_index))
+                visitor(leaves[leaf_index]);
+    }
+
+    constexpr const std::bitset<LeafCount> &dirty_leaves() const noexcept
+    {
+        return dirty;
+    }
+
+    constexpr void clear_dirty() noexcept
+    {
+        dirty.reset();
+    }
+
+private:
+    Value value;
+    std::bitset<LeafCount> dirty;
+};
@@ -1,4 +1,11 @@
 #include "compile_time_json/compile_time_json.hpp"
+#include "compile_time_json/lazy_json_view.hpp"
+#include "compile_time_json/leaf_table.hpp"
+#include "compile_time_json/merge_patch.hpp"
+#include "compile_time_json/projection.hpp"
+#include "compile_time_json/stream_parser.hpp"
+#include "compile_time_json/tracked_json.hpp"
+#include "example/example_config.hpp"
 
 template <auto MyJson>
 void compile_time_test_my_json()
@@ -8,6 +15,8 @@ void compile_time_test_my_json()
     static_assert(!MyJson["e_12sdfsdf"_member]["e_s"_member].value);
     static_assert(MyJson["e_12sdfsdf"_member]["e_sdf"_member].value == -22);
     static_assert(MyJson["e_12sdfsdf"_member]["list"_member].template get<3>().value == 12354.1234);
+    static_assert(MyJson["/e_12sdfsdf/list/3"_path].value == 12354.1234);
+    static_assert(MyJson["/e_12sdfsdf/e_sdfsd/e_sdfsd1"_path].value == 1235);
 }
 
 int main()
@@ -37,8 +46,65 @@ int main()
     std::cout << json_1.get<"e_12"_member>().get<0>().value << std::endl;
 
     json_1.get<"e_12"_member>().get<0>().value = 12;
+    json_1["/e_12sdfsdf/e_sdfsd/e_sdfsd1"_path].value = "set through a path";
 
-    std::cout << json_1.get<"e_12"_member>().get<0>().value << std::endl;
+    std::cout << json_1.get<"e_12"_member>().get<0>().value << " " << json_1["e_12sdfsdf"_member]["e_sdfsd"_member]["e_sdfsd1"_member].value << std::endl;
+
+    const LazyJsonView<decltype(json_1)> lazy_json_1{R"(
+    {
+        "e_12": [1.5],
+        "e_12s": 2.5,
+        "unknown": {"a": [1, "]"]},
+        "e_12sdfsdf": {"e_": false, "e_sdf": 3.25, "e_sdfsd": {"e_sdfsd1": "lazy\tvalue"}}
+    }
+    )"};
+
+    std::cout << lazy_json_1["e_12sdfsdf"_member]["e_sdfsd"_member]["e_sdfsd1"_member].value << std::endl;
+    std::cout << lazy_json_1.get<"e_12s"_member>().value << std::endl;
+
+    for (const auto &unknown_member : apply_merge_patch(json_1, R"({"e_12s": 0.5, "e_12sdfsdf": {"e_sdf": 1.5, "e_new": 1}})"))
+        std::cout << "Unknown member in patch: " << unknown_member << std::endl;
+
+    std::cout << json_1["e_12s"_member].value << " " << json_1["e_12sdfsdf"_member]["e_sdf"_member].value << std::endl;
+
+    auto projected_json_1 = project<"e_12s"_member, "/e_12sdfsdf/e_sdf"_path>(json_1);
+    projected_json_1["/e_12sdfsdf/e_sdf"_path].value *= 2;
+    write_back_projection(projected_json_1, json_1);
+
+    std::cout << sizeof(projected_json_1) << " of " << sizeof(json_1) << " bytes projected, e_sdf is now " << json_1["e_12sdfsdf"_member]["e_sdf"_member].value << std::endl;
+
+    for (const auto &leaf : JsonLeafTable<decltype(json_1)>::leaves())
+    {
+        std::cout << leaf.path << " at offset " << leaf.offset << ": ";
+        visit_json_leaf(json_1, leaf, [](const auto &value) {
+            if constexpr (requires { std::cout << value; })
+                std::cout << value;
+        });
+        std::cout << std::endl;
+    }
+
+    std::cout << example_config["service"_member].value << " listens on " << example_config["/port"_path].value << std::endl;
+
+    ExampleConfig streamed_config = example_config;
+    JsonStreamParser stream_parser{streamed_config};
+    const std::string_view stream = R"({"port": 9090, "replicas": ["ap-south", "sa-east"]} {"service": "streamed", "limits": {"timeout": 3.5}})";
+    for (std::size_t chunk_begin = 0; chunk_begin < stream.size();)
+    {
+        const auto chunk = std::span{stream}.subspan(chunk_begin, std::min<std::size_t>(7, stream.size() - chunk_begin));
+        chunk_begin += stream_parser.feed(chunk);
+        if (stream_parser.is_record_ready())
+        {
+            std::cout << streamed_config["service"_member].value << " listens on " << streamed_config["/port"_path].value << " in " << streamed_config["/replicas/0"_path].value << std::endl;
+            stream_parser.next_record();
+        }
+    }
+
+    TrackedJson<ExampleConfig> tracked_config{example_config};
+    tracked_config["/limits/timeout"_path].value = 4.5;
+    tracked_config["replicas"_member][1].value = "eu-central";
+    std::cout << "limits changed: " << tracked_config.changed<"/limits">() << ", port changed: " << tracked_config.changed<"/port">() << std::endl;
+    tracked_config.for_each_changed([](const JsonLeafDescriptor &leaf) { std::cout << leaf.path << " changed" << std::endl; });
+    tracked_config.clear_dirty();
 
     compile_time_test_my_json<R"(
     {
@@ -61,4 +127,4 @@ int main()
         },
     }
     )"_json>();
-}
\ No newline at end of file
+}
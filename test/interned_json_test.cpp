@@ -0,0 +1,80 @@
+#include "compile_time_json/compile_time_json.hpp"
+#include "compile_time_json/leaf_table.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <variant>
+#include <vector>
+
+struct Document
+{
+    static constexpr FixedLengthString Source = R"({
+        "name": "service",
+        "negative": -1.5,
+        "small": -0.25,
+        "whole": -3.0,
+        "positive": 12.75,
+        "signed": -42,
+        "unsigned": 7,
+        "enabled": false,
+        "none": null,
+        "nested": {"list": [-0.5, 1.5], "records": [{"w": -2.5}, {"w": 0.125}]}
+    })";
+};
+
+using LeafValue = std::variant<std::monostate, bool, std::intmax_t, std::uintmax_t, double, std::string>;
+
+// The values of every leaf in leaf table order, which is the same for both kinds of types.
+template <typename Value>
+std::vector<LeafValue> leaf_values(const Value &value)
+{
+    std::vector<LeafValue> values;
+    auto visitor = [&](const auto &leaf) {
+        using Leaf = std::remove_cvref_t<decltype(leaf)>;
+        if constexpr (Leaf::JsonType == JsonValueType::NULL_VALUE)
+            values.emplace_back();
+        else if constexpr (Leaf::JsonType == JsonValueType::STRING)
+            values.emplace_back(std::string{leaf.value});
+        else
+            values.emplace_back(leaf.value);
+    };
+    for_each_json_leaf(value, visitor);
+    return values;
+}
+
+// Interned leaves are decoded at compile time, they have to hold the same values as the ones of _json.
+void test_interned_values()
+{
+    const auto json = operator""_json<Document::Source>();
+    const auto interned = construct_interned_json<Document>();
+
+    assert(leaf_values(interned) == leaf_values(json));
+    assert(leaf_values(json).size() == JsonLeafTable<decltype(json)>::LeafCount);
+
+    assert(interned["negative"_member].value == -1.5);
+    assert(interned["small"_member].value == -0.25);
+    assert(interned["whole"_member].value == -3.0);
+    assert(interned["positive"_member].value == 12.75);
+    assert(interned["signed"_member].value == -42);
+    assert(interned["/nested/list/0"_path].value == -0.5);
+    assert(interned["/nested/records/0/w"_path].value == -2.5);
+    assert(interned["name"_member].value == "service");
+}
+
+// Doubles decoded in a constant expression take the same path as the interned leaves.
+void test_constant_evaluated_doubles()
+{
+    constexpr auto json = R"({"negative": -1.5, "small": -0.25, "list": [-12.75, 0.5]})"_json;
+    static_assert(json["negative"_member].value == -1.5);
+    static_assert(json["small"_member].value == -0.25);
+    static_assert(json["/list/0"_path].value == -12.75);
+    static_assert(json["/list/1"_path].value == 0.5);
+}
+
+int main()
+{
+    test_interned_values();
+    test_constant_evaluated_doubles();
+    return 0;
+}
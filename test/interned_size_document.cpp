@@ -0,0 +1,54 @@
+#include "compile_time_json/compile_time_json.hpp"
+#include "compile_time_json/json_reader.hpp"
+
+#include <iostream>
+#include <string>
+
+// Document of many small sections, which is where the names of the _json types grow the most. The same program is built once with
+// the _json type and once with the interned type for interned_size_test.sh.
+constexpr std::size_t SectionCount = 14;
+
+constexpr std::string generate_document()
+{
+    std::string document = "{";
+    for (std::size_t section = 0; section < SectionCount; section++)
+    {
+        const std::string number{static_cast<char>('0' + section / 10), static_cast<char>('0' + section % 10)};
+        if (section)
+            document += ", ";
+        document += R"("section_)" + number + R"(": {"enabled": true, "name": "section )" + number + R"(", "limit": )" + number +
+                    R"(, "retry": {"count": 3, "delay": 0.5}})";
+    }
+    return document + "}";
+}
+
+struct SizeDocument
+{
+    static constexpr FixedLengthString<generate_document().size() + 1> Source{generate_document().c_str()};
+};
+
+#ifdef INTERNED_SIZE_TEST_INTERNED
+using Document = InternedJsonType<SizeDocument>;
+#else
+using Document = decltype(operator""_json<SizeDocument::Source>());
+#endif
+
+// Instantiates the usual operations on the whole document, so the type shows up in the symbols and debug info of each of them.
+int main(const int argc, const char *const *const argv)
+{
+#ifdef INTERNED_SIZE_TEST_INTERNED
+    auto document = construct_interned_json<SizeDocument>();
+#else
+    auto document = operator""_json<SizeDocument::Source>();
+#endif
+
+    if (argc > 1)
+    {
+        JsonReader reader{argv[1]};
+        reader.read_value(document);
+    }
+
+    const Document copy = document;
+    std::cout << copy["section_07"_member]["limit"_member].value << " " << copy["section_13"_member]["retry"_member]["delay"_member].value << std::endl;
+    return 0;
+}
@@ -0,0 +1,48 @@
+#!/bin/sh
+# Compares the program of interned_size_document.cpp built with the _json type and with the interned type of the same document. The
+# interned build has to be smaller in symbol names, .debug_str and file size. .debug_str is only compared when both binaries kept
+# their debug info, which needs --strip=never in fastbuild.
+set -eu
+
+json_binary="$1"
+interned_binary="$2"
+
+symbol_name_bytes()
+{
+    nm --format=posix "$1" | awk '{ bytes += length($1) } END { print bytes + 0 }'
+}
+
+debug_str_bytes()
+{
+    size -A "$1" | awk '$1 == ".debug_str" { bytes = $2 } END { print bytes + 0 }'
+}
+
+file_bytes()
+{
+    wc -c < "$1" | tr -d ' '
+}
+
+failed=0
+
+compare()
+{
+    echo "{\"benchmark\": \"interned_size/$1\", \"json_bytes\": $2, \"interned_json_bytes\": $3}"
+    if [ "$3" -ge "$2" ]; then
+        echo "The interned build is not smaller in $1." >&2
+        failed=1
+    fi
+}
+
+compare symbol_names "$(symbol_name_bytes "$json_binary")" "$(symbol_name_bytes "$interned_binary")"
+
+json_debug_str="$(debug_str_bytes "$json_binary")"
+interned_debug_str="$(debug_str_bytes "$interned_binary")"
+if [ "$json_debug_str" -gt 0 ] && [ "$interned_debug_str" -gt 0 ]; then
+    compare debug_str "$json_debug_str" "$interned_debug_str"
+else
+    echo "The binaries have no .debug_str, skipping it."
+fi
+
+compare file "$(file_bytes "$json_binary")" "$(file_bytes "$interned_binary")"
+
+exit "$failed"
@@ -0,0 +1,88 @@
+#include "compile_time_json/compile_time_json.hpp"
+#include "compile_time_json/projection.hpp"
+
+#include <cassert>
+#include <string>
+
+auto json = R"({"a": {"b": [1, 2, {"c": 3.5}], "s": "x"}, "records": [{"id": 1}, {"id": 2}], "empty": [], "flag": true})"_json;
+using Schema = decltype(json);
+
+template <FixedLengthString Path>
+constexpr bool is_path_in_schema()
+{
+    return is_json_path_in_schema<JsonPath<Path>, Schema>();
+}
+
+// Paths are empty literal types, so generic code can take them as template arguments.
+template <auto Path>
+auto &get_at(Schema &value)
+{
+    return value[Path];
+}
+
+void test_resolve()
+{
+    static_assert(std::is_same_v<decltype(json["/a/b/2/c"_path]), decltype(json["a"_member]["b"_member].get<2>()["c"_member])>);
+    assert(&json["/a/b/2/c"_path] == &json["a"_member]["b"_member].get<2>()["c"_member]);
+    assert(&json["/records/1/id"_path] == &json["records"_member][1]["id"_member]);
+    assert(&json[""_path] == &json);
+
+    get_at<"/a/b/2/c"_path>(json).value = 4.5;
+    assert(json["a"_member]["b"_member].get<2>()["c"_member].value == 4.5);
+    get_at<"/a/s"_path>(json).value = "y";
+    assert(json["a"_member]["s"_member].value == "y");
+
+    const auto &const_json = json;
+    assert(const_json["/records/0/id"_path].value == 1);
+}
+
+void test_schema_checks()
+{
+    static_assert(is_path_in_schema<"">());
+    static_assert(is_path_in_schema<"/a">());
+    static_assert(is_path_in_schema<"/a/b/2/c">());
+    static_assert(is_path_in_schema<"/records/1/id">());
+    static_assert(is_path_in_schema<"/empty">());
+
+    // Members that are not part of the schema.
+    static_assert(!is_path_in_schema<"/missing">());
+    static_assert(!is_path_in_schema<"/a/c">());
+    static_assert(!is_path_in_schema<"/records/0/name">());
+
+    // Segments of arrays that are not indices, or are indices written with leading zeros.
+    static_assert(!is_path_in_schema<"/a/b/c">());
+    static_assert(!is_path_in_schema<"/a/b/01">());
+    static_assert(!is_path_in_schema<"/records/-1">());
+
+    // Indices out of range, for uniform, mixed, empty and sparse arrays.
+    static_assert(!is_path_in_schema<"/records/2">());
+    static_assert(!is_path_in_schema<"/a/b/3">());
+    static_assert(!is_path_in_schema<"/empty/0">());
+    using Sparse = JsonProjectionType<Schema, "/records/1/id"_path>;
+    static_assert(is_json_path_in_schema<JsonPath<"/records/1/id">, Sparse>());
+    static_assert(!is_json_path_in_schema<JsonPath<"/records/0/id">, Sparse>());
+
+    // Paths that continue past a leaf.
+    static_assert(!is_path_in_schema<"/flag/x">());
+    static_assert(!is_path_in_schema<"/a/s/0">());
+    static_assert(!is_path_in_schema<"/a/b/0/c">());
+}
+
+void test_syntax_checks()
+{
+    static_assert(is_valid_json_path(""));
+    static_assert(is_valid_json_path("/a/0"));
+    static_assert(!is_valid_json_path("a"));
+    static_assert(!is_valid_json_path("/a/"));
+    static_assert(!is_valid_json_path("/a//b"));
+    static_assert(!is_valid_json_path("/"));
+    static_assert(!is_valid_json_path("/a~1b"));
+}
+
+int main()
+{
+    test_resolve();
+    test_schema_checks();
+    test_syntax_checks();
+    return 0;
+}
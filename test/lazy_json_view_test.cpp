@@ -0,0 +1,42 @@
+#include "compile_time_json/lazy_json_view.hpp"
+
+#include <cassert>
+#include <string_view>
+
+template <typename Schema>
+bool fails_with(const LazyJsonView<Schema> &lazy_json, const std::string_view error, const auto &access)
+{
+    try
+    {
+        access(lazy_json);
+    }
+    catch (const JsonReader::FailureResult &failure)
+    {
+        return failure.error == error;
+    }
+    return false;
+}
+
+void test_lazy_json_view()
+{
+    using Schema = decltype(R"({"a": 1, "b": "x", "c": {"d": 2.5}})"_json);
+
+    // Only the members in front of the requested one are scanned, so the broken tail is reported once a lookup reaches it.
+    const LazyJsonView<Schema> lazy_json{R"({"unknown": [1, {"x": "]"}], "b": "lazy", "a": 7, "c": {"d": 1.5} "broken")"};
+    assert(lazy_json["a"_member].value == 7);
+    // The position of "b" was cached while looking for "a".
+    assert(lazy_json["b"_member].value == "lazy");
+    assert(fails_with(lazy_json, "Expected ',' or '}'.", [](const auto &json) { return json["c"_member]; }));
+
+    const LazyJsonView<Schema> missing_member{R"({"a": 1})"};
+    assert(fails_with(missing_member, "The member is missing from the input.", [](const auto &json) { return json["b"_member]; }));
+
+    const LazyJsonView<Schema> mismatched_brackets{R"({"unknown": [1}, "a": 1})"};
+    assert(fails_with(mismatched_brackets, "Mismatched closing bracket.", [](const auto &json) { return json["a"_member]; }));
+}
+
+int main()
+{
+    test_lazy_json_view();
+    return 0;
+}
@@ -0,0 +1,121 @@
+#include "compile_time_json/merge_patch.hpp"
+
+#include <cassert>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+const auto Config = R"({
+    "name": "service",
+    "port": 8080,
+    "limits": {"connections": 64, "timeout": 2.5, "retry": {"count": 3, "backoff": 0.5}},
+    "records": [{"x": 1, "y": 2}, {"x": 3, "y": 4}],
+    "tags": ["a", "b"],
+    "enabled": true
+})"_json;
+
+struct ExpectedFailure
+{
+    std::string_view error;
+    std::size_t char_index;
+    std::size_t line;
+    std::size_t column;
+};
+
+std::optional<JsonParseFailure> merge_patch_failure(auto &target, const std::string_view patch)
+{
+    try
+    {
+        apply_merge_patch(target, patch);
+    }
+    catch (const JsonParseFailure &failure)
+    {
+        return failure;
+    }
+    return std::nullopt;
+}
+
+void test_nested_merge()
+{
+    auto config = Config;
+    const auto unknown_members = apply_merge_patch(config, R"({"port": 9090, "limits": {"retry": {"count": 5}}, "records": [{"x": 10}, {"y": 40}], "tags": ["c", "d"]})");
+
+    assert(unknown_members.empty());
+    assert(config["name"_member].value == "service");
+    assert(config["port"_member].value == 9090);
+    assert(config["/limits/connections"_path].value == 64);
+    assert(config["/limits/timeout"_path].value == 2.5);
+    assert(config["/limits/retry/count"_path].value == 5);
+    assert(config["/limits/retry/backoff"_path].value == 0.5);
+    assert(config["/records/0/x"_path].value == 10);
+    assert(config["/records/0/y"_path].value == 2);
+    assert(config["/records/1/x"_path].value == 3);
+    assert(config["/records/1/y"_path].value == 40);
+    assert(config["/tags/0"_path].value == "c");
+    assert(config["/tags/1"_path].value == "d");
+    assert(config["enabled"_member].value);
+
+    // An empty patch changes nothing.
+    auto unchanged = Config;
+    assert(apply_merge_patch(unchanged, " {} ").empty());
+    assert(unchanged["/limits/retry/count"_path].value == 3);
+}
+
+void test_unknown_members()
+{
+    auto config = Config;
+    const auto unknown_members = apply_merge_patch(config, R"({
+        "bogus": {"deep": [1, {"x": 2}]},
+        "limits": {"unknown": null, "retry": {"jitter": true, "count": 7}},
+        "records": [{"x": 5, "bogus": 1}, {"y": 6, "a/b~c": {"z": []}}],
+        "port": 1
+    })");
+
+    assert(unknown_members == (std::vector<std::string>{"/bogus", "/limits/unknown", "/limits/retry/jitter", "/records/0/bogus", "/records/1/a~1b~0c"}));
+    assert(config["/limits/retry/count"_path].value == 7);
+    assert(config["/records/0/x"_path].value == 5);
+    assert(config["/records/1/y"_path].value == 6);
+    assert(config["port"_member].value == 1);
+}
+
+void test_failures()
+{
+    const std::pair<std::string_view, ExpectedFailure> failures[]{
+        {R"({"port": null})", {"Members of the schema can not be removed by a patch.", 9, 1, 10}},
+        {R"({"limits": {"retry": null}})", {"Members of the schema can not be removed by a patch.", 21, 1, 22}},
+        {R"({"records": [null, {}]})", {"Members of the schema can not be removed by a patch.", 13, 1, 14}},
+        {R"({"port": "8080"})", {"Expected a number.", 9, 1, 10}},
+        {"{\"name\": \"a\",\n \"enabled\": 1}", {"Expected a boolean.", 26, 2, 13}},
+        {R"({"limits": 5})", {"Expected '{'.", 11, 1, 12}},
+        {R"({"records": [{}, {}, {}]})", {"The array has more elements than the schema.", 21, 1, 22}},
+        {R"({"records": [{}]})", {"The array has fewer elements than the schema.", 12, 1, 13}},
+        {R"({"tags": [1, "b"]})", {"Expected a string.", 10, 1, 11}},
+        {"{\"port\": 1}\n x", {"Unexpected characters after the patch.", 13, 2, 2}},
+        {R"({"port": 1}})", {"Unexpected characters after the patch.", 11, 1, 12}},
+    };
+
+    for (const auto &[patch, expected] : failures)
+    {
+        auto config = Config;
+        const auto failure = merge_patch_failure(config, patch);
+        assert(failure);
+        assert(failure->error == expected.error);
+        assert(failure->char_index == expected.char_index);
+        assert(failure->line == expected.line);
+        assert(failure->column == expected.column);
+    }
+
+    // Members before the failure are already patched.
+    auto config = Config;
+    assert(merge_patch_failure(config, R"({"port": 1, "enabled": 2})"));
+    assert(config["port"_member].value == 1);
+}
+
+int main()
+{
+    test_nested_merge();
+    test_unknown_members();
+    test_failures();
+    return 0;
+}
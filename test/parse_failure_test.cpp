@@ -0,0 +1,78 @@
+#include "compile_time_json/compile_time_json.hpp"
+#include "compile_time_json/json_reader.hpp"
+
+#include <cassert>
+#include <string_view>
+
+using enum JsonExpectedTokens;
+
+constexpr bool is_failure(const JsonParseFailure &failure, const std::string_view error, const std::size_t char_index, const std::size_t line, const std::size_t column, const JsonExpectedTokens expected)
+{
+    return failure.error == error && failure.char_index == char_index && failure.line == line && failure.column == column && failure.expected == expected;
+}
+
+// The compile time parser stops at the first character no alternative can continue with, which is what JsonSyntaxError reports.
+template <FixedLengthString Document>
+constexpr bool fails_at_compile_time(const std::size_t char_index, const std::size_t line, const std::size_t column, const JsonExpectedTokens expected)
+{
+    static_assert(!ParseContext<Document>::Outcome.is_success);
+    return is_failure(ParseContext<Document>::get_failure(), "Unexpected character.", char_index, line, column, expected);
+}
+
+void test_compile_time_failures()
+{
+    static_assert(ParseContext<"{\"a\": [1, {\"b\": null}]}">::Outcome.is_success);
+
+    // Missing ':' after a member name.
+    static_assert(fails_at_compile_time<"{\"a\" 1}">(5, 1, 6, COLON));
+    // Bad literal, reported at the first character that doesn't match, on the third line.
+    static_assert(fails_at_compile_time<"{\n  \"a\": 1,\n  \"b\": tru\n}">(22, 3, 11, LITERAL));
+    // Trailing characters after the document.
+    static_assert(fails_at_compile_time<"{\"a\": 1} x">(9, 1, 10, END_OF_INPUT));
+    static_assert(fails_at_compile_time<"{\"a\": 1,, }">(8, 1, 9, MEMBER_NAME | OBJECT_END));
+    static_assert(fails_at_compile_time<"{\"a\": [1, 2}">(11, 1, 12, COMMA | ARRAY_END | DIGIT | DOT));
+    static_assert(fails_at_compile_time<"{\"a\": \"x\ty\"}">(8, 1, 9, QUOTE));
+
+    static_assert(is_failure(ParseContext<"">::get_failure(), "Unexpected end of the input.", 0, 1, 1, OBJECT_BEGIN));
+    static_assert(describe_json_expected_tokens(COMMA | ARRAY_END | DIGIT | DOT) == "',', ']', a digit or '.'");
+}
+
+auto json = R"({"a": 1, "b": {"c": true, "d": [1.5, 2.5]}, "s": "x", "n": null})"_json;
+
+JsonParseFailure read_failure(const std::string_view input)
+{
+    auto target = json;
+    try
+    {
+        JsonReader reader{input};
+        reader.read_value(target);
+    }
+    catch (const JsonParseFailure &failure)
+    {
+        return failure;
+    }
+    assert(false);
+    return {};
+}
+
+void test_reader_failures()
+{
+    assert(is_failure(read_failure("{\"a\" 1}"), "Expected ':' after the member name.", 5, 1, 6, COLON));
+    assert(is_failure(read_failure("{\n  \"a\": 1,\n  \"b\": {\"c\": tru}\n}"), "Expected a boolean.", 25, 3, 14, LITERAL));
+    assert(is_failure(read_failure("{\"a\": \"1\"}"), "Expected a number.", 6, 1, 7, DIGIT | DOT));
+    assert(is_failure(read_failure("{\"n\": nul}"), "Expected null.", 6, 1, 7, LITERAL));
+    assert(is_failure(read_failure("{\"s\": 5}"), "Expected a string.", 6, 1, 7, QUOTE));
+    assert(is_failure(read_failure("{\"a\": 1 \"s\": \"x\"}"), "Expected ',' or '}'.", 8, 1, 9, COMMA | OBJECT_END));
+    assert(is_failure(read_failure("{\"a\": 1"), "Expected ',' or '}'.", 7, 1, 8, COMMA | OBJECT_END));
+    assert(is_failure(read_failure("{\"b\": {\"d\": [1.5]}}"), "The array has fewer elements than the schema.", 12, 1, 13, NONE));
+    assert(is_failure(read_failure("{\"b\": {\"d\": [1.5, 2.5, 3]}}"), "The array has more elements than the schema.", 23, 1, 24, NONE));
+    assert(is_failure(read_failure("{\"unknown\": [1}, \"a\": 1}"), "Mismatched closing bracket.", 14, 1, 15, ARRAY_END));
+    assert(is_failure(read_failure("{\"unknown\": @, \"a\": 1}"), "Expected a value but couldn't find any.", 12, 1, 13, VALUE));
+}
+
+int main()
+{
+    test_compile_time_failures();
+    test_reader_failures();
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include "compile_time_json/projection.hpp"
+
+#include <array>
+#include <cassert>
+#include <string_view>
+#include <type_traits>
+
+void test_projection()
+{
+    auto json = R"({"limits": {"timeout": 1.5, "retries": 3}, "port": 80, "records": [{"id": 1, "w": 0.5}, {"id": 2, "w": 1.5}, {"id": 3, "w": 2.5}]})"_json;
+    using Full = decltype(json);
+
+    // A path below a selected member adds nothing, the member is projected as a whole.
+    using Overlapping = JsonProjectionType<Full, "limits"_member, "/limits/timeout"_path>;
+    static_assert(std::is_same_v<Overlapping, JsonProjectionType<Full, "limits"_member>>);
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(std::declval<Overlapping &>()["limits"_member])>, std::remove_cvref_t<decltype(json["limits"_member])>>);
+
+    // Selected elements of a uniform array keep their indices in a sparse array.
+    using Sparse = JsonProjectionType<Full, "/records/2/w"_path>;
+    using SparseRecords = std::remove_cvref_t<decltype(std::declval<Sparse &>()["records"_member])>;
+    static_assert(!is_uniform_json_array<SparseRecords>);
+    static_assert(SparseRecords::ElementIndices == std::array<std::size_t, 1>{2});
+    static_assert(std::remove_cvref_t<decltype(std::declval<SparseRecords &>().template get<2>())>::MemberNames == std::array<std::string_view, 1>{"w"});
+
+    // Elements are ordered by index and selected once however many paths lead into them.
+    using Reordered = JsonProjectionType<Full, "/records/2/w"_path, "/records/0"_path, "/records/2/id"_path>;
+    using ReorderedRecords = std::remove_cvref_t<decltype(std::declval<Reordered &>()["records"_member])>;
+    static_assert(ReorderedRecords::ElementIndices == std::array<std::size_t, 2>{0, 2});
+    static_assert(std::remove_cvref_t<decltype(std::declval<ReorderedRecords &>().template get<2>())>::MemberNames == std::array<std::string_view, 2>{"id", "w"});
+
+    auto projected = project<"/limits/timeout"_path, "/records/2/w"_path>(json);
+    assert(projected["/limits/timeout"_path].value == 1.5 & projected["/records/2/w"_path].value == 2.5);
+
+    projected["/limits/timeout"_path].value = 4.5;
+    projected["/records/2/w"_path].value = 7.5;
+    json["/limits/retries"_path].value = 5;
+    write_back_projection(projected, json);
+
+    assert(json["/limits/timeout"_path].value == 4.5 & json["/records/2/w"_path].value == 7.5);
+    assert(json["/limits/retries"_path].value == 5 & json["port"_member].value == 80);
+    assert(json["/records/1/w"_path].value == 1.5 & json["/records/2/id"_path].value == 3);
+
+    json["/records/2/w"_path].value = 8.5;
+    copy_to_projection(json, projected);
+    assert(projected["/records/2/w"_path].value == 8.5);
+}
+
+int main()
+{
+    test_projection();
+    return 0;
+}
@@ -0,0 +1,175 @@
+#include "compile_time_json/stream_parser.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+auto record = R"({"id": 0, "name": "", "weight": 0.0, "tags": [0, 0], "flag": false})"_json;
+
+struct Record
+{
+    std::uintmax_t id;
+    std::string name;
+    double weight;
+    std::uintmax_t first_tag;
+    std::uintmax_t second_tag;
+    bool flag;
+
+    bool operator==(const Record &) const = default;
+};
+
+// Records on one line each and across lines, with unknown members of every kind, escapes and numbers in exponent form.
+constexpr std::string_view Input = R"({"id": 1, "name": "plain", "weight": 1.5, "tags": [1, 2], "flag": true}{"id": 2, "name": "b", "weight": 2, "tags": [3, 4], "flag": false}
+{"unknown": {"nested": ["]", "}", {"deep": [1, -2e3, true, null]}], "text": "a\"b\\"}, "id": 22, "name": "esc\"aped\\ tab\t end\n",
+ "weight": -12.25e-1, "tags": [30, 40], "flag": false}
+  {"name": "last", "tags": [5, 6], "skipped": "x}]", "id": 333, "weight": 1e2, "flag": true, "more": null, "number": 0.5E+3}
+)";
+
+const std::vector<Record> ExpectedRecords{
+    {1, "plain", 1.5, 1, 2, true},
+    {2, "b", 2.0, 3, 4, false},
+    {22, "esc\"aped\\ tab\t end\n", -1.225, 30, 40, false},
+    {333, "last", 100.0, 5, 6, true},
+};
+
+// Writes the input to a pipe and feeds the parser with what each read returns. The first read stops at the split point and the
+// rest is read in chunks of the given size, so tokens are cut at every position for some of the runs.
+std::vector<Record> parse_through_pipe(JsonStreamParser<decltype(record)> &parser, const std::string_view input, const std::size_t split, const std::size_t chunk_size)
+{
+    int pipe_ends[2];
+    const auto pipe_result = pipe(pipe_ends);
+    assert(pipe_result == 0);
+    const auto write_count = write(pipe_ends[1], input.data(), input.size());
+    assert(write_count == static_cast<ssize_t>(input.size()));
+    close(pipe_ends[1]);
+
+    std::vector<Record> records;
+    std::vector<char> buffer(std::max(split, chunk_size));
+    try
+    {
+        for (std::size_t read_size = split ? split : chunk_size;; read_size = chunk_size)
+        {
+            const auto read_count = read(pipe_ends[0], buffer.data(), read_size);
+            assert(read_count >= 0);
+            if (!read_count)
+                break;
+
+            for (std::span<const char> chunk{buffer.data(), static_cast<std::size_t>(read_count)}; !chunk.empty();)
+            {
+                chunk = chunk.subspan(parser.feed(chunk));
+                if (parser.is_record_ready())
+                {
+                    records.push_back({record["id"_member].value, record["name"_member].value, record["weight"_member].value,
+                                       record["tags"_member].get<0>().value, record["tags"_member].get<1>().value, record["flag"_member].value});
+                    parser.next_record();
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        close(pipe_ends[0]);
+        throw;
+    }
+
+    close(pipe_ends[0]);
+    assert(parser.is_between_records());
+    return records;
+}
+
+std::vector<Record> parse_through_pipe(const std::string_view input, const std::size_t split, const std::size_t chunk_size)
+{
+    JsonStreamParser parser{record};
+    return parse_through_pipe(parser, input, split, chunk_size);
+}
+
+std::optional<JsonParseFailure> parse_failure_through_pipe(JsonStreamParser<decltype(record)> &parser, const std::string_view input, const std::size_t split, const std::size_t chunk_size)
+{
+    try
+    {
+        parse_through_pipe(parser, input, split, chunk_size);
+    }
+    catch (const JsonParseFailure &failure)
+    {
+        return failure;
+    }
+    return std::nullopt;
+}
+
+void test_split_records()
+{
+    for (std::size_t split = 0; split < Input.size(); split++)
+        for (const std::size_t chunk_size : {std::size_t{1}, std::size_t{7}, Input.size()})
+            assert(parse_through_pipe(Input, split, chunk_size) == ExpectedRecords);
+}
+
+void test_split_failures()
+{
+    struct ExpectedFailure
+    {
+        std::string_view input;
+        std::string_view error;
+        std::size_t char_index;
+        std::size_t line;
+        std::size_t column;
+    };
+
+    const ExpectedFailure failures[]{
+        {"{\"id\": 1}\n{\"id\": 2,\n \"name\": 5}", "Expected a string.", 29, 3, 10},
+        {"{\"id\": 1,\n \"unk\": @@garbage@@, \"id\": 5}", "Expected a value but couldn't find any.", 18, 2, 9},
+        {"{\"unk\": [1, {\"a\": \"]\"}}, \"id\": 5}", "Mismatched closing bracket.", 22, 1, 23},
+        {"{\"id\": 12x, \"name\": \"a\"}", "The number does not fit the type of the schema member.", 7, 1, 8},
+        {"{\"name\": \"a\", \"tags\": [1]}", "The array has fewer elements than the schema.", 24, 1, 25},
+        {"{\"flag\": truth}", "Expected a boolean.", 9, 1, 10},
+        {"{\"name\": \"a\nbcdefgh\",\n \"id\" x}", "Expected ':' after the member name.", 28, 3, 7},
+    };
+
+    for (const auto &expected : failures)
+        for (std::size_t split = 0; split < expected.input.size(); split++)
+            for (const std::size_t chunk_size : {std::size_t{1}, std::size_t{3}, expected.input.size()})
+            {
+                JsonStreamParser parser{record};
+                const auto failure = parse_failure_through_pipe(parser, expected.input, split, chunk_size);
+                assert(failure);
+                assert(failure->error == expected.error);
+                assert(failure->char_index == expected.char_index);
+                assert(failure->line == expected.line);
+                assert(failure->column == expected.column);
+            }
+}
+
+// next_record() after a failure starts over, even when the parser failed inside nested values, an escape or a skipped container.
+void test_records_after_failure()
+{
+    const std::string_view malformed_records[]{
+        "{\"name\": 5",
+        "{\"id\": 1, \"tags\": [1, 2, 3]",
+        "{\"unk\": [{\"a\": \"x\"}}",
+        "{\"name\": \"a\\\"b\", \"flag\": nul}",
+    };
+
+    for (const auto malformed_record : malformed_records)
+        for (std::size_t split = 0; split < malformed_record.size(); split++)
+        {
+            JsonStreamParser parser{record};
+            assert(parse_failure_through_pipe(parser, malformed_record, split, 1));
+            parser.next_record();
+            assert(parser.is_between_records());
+            assert(parse_through_pipe(parser, Input, split, 7) == ExpectedRecords);
+        }
+}
+
+int main()
+{
+    test_split_records();
+    test_split_failures();
+    test_records_after_failure();
+    return 0;
+}
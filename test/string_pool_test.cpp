@@ -0,0 +1,110 @@
+// Included first so the header is checked to compile on its own.
+#include "compile_time_json/json_string_pool.hpp"
+
+#include "compile_time_json/compile_time_json.hpp"
+#include "compile_time_json/json_reader.hpp"
+
+#include <cassert>
+#include <memory_resource>
+#include <string_view>
+
+// Pooled objects without runtime state are constant expressions, their numbers have to decode like the ones of _json.
+void test_pooled_values()
+{
+    constexpr auto config = R"({"region": "eu-west", "negative": -1.5, "small": -0.25, "count": -3, "limits": {"ratio": 2.5}})"_pooled_json;
+    static_assert(config["region"_member].value == "eu-west");
+    static_assert(config["negative"_member].value == -1.5);
+    static_assert(config["small"_member].value == -0.25);
+    static_assert(config["count"_member].value == -3);
+    static_assert(config["/limits/ratio"_path].value == 2.5);
+
+    const auto json = R"({"region": "eu-west", "negative": -1.5, "small": -0.25, "count": -3, "limits": {"ratio": 2.5}})"_json;
+    assert(json["region"_member].value == config["region"_member].value);
+    assert(json["negative"_member].value == config["negative"_member].value);
+    assert(json["small"_member].value == config["small"_member].value);
+}
+
+// Equal string values and values contained in others share the characters of the literal pool.
+void test_literal_deduplication()
+{
+    constexpr auto config = R"({"region": "eu-west", "backup": {"region": "eu-west"}, "zone": "west", "escaped": "a\"b"})"_pooled_json;
+    constexpr std::string_view region = config["region"_member].value;
+    constexpr std::string_view backup_region = config["/backup/region"_path].value;
+    constexpr std::string_view zone = config["zone"_member].value;
+
+    static_assert(region.data() == backup_region.data());
+    static_assert(zone.data() == region.data() + 3);
+    static_assert(config["escaped"_member].value == "a\"b");
+}
+
+void test_intern()
+{
+    std::pmr::monotonic_buffer_resource resource;
+    JsonStringPool string_pool{&resource};
+    assert(string_pool.get_resource() == &resource);
+
+    std::string first{"us-east"};
+    const auto interned = string_pool.intern(first);
+    first[0] = 'x';
+    assert(interned == "us-east");
+    assert(interned.data() != first.data());
+
+    assert(string_pool.intern(std::string{"us-east"}).data() == interned.data());
+    assert(string_pool.intern("eu-west") == "eu-west");
+    assert(string_pool.intern("eu-west").data() != interned.data());
+    assert(string_pool.intern("").empty());
+    assert(string_pool.size() == 2);
+}
+
+void test_read_with_string_pool()
+{
+    auto config = R"({"region": "eu-west", "backup": {"region": "eu-west"}, "port": 1})"_pooled_json;
+    const std::string input = R"({"region": "us-east", "backup": {"region": "us-east"}, "port": 2, "name": "q\"uote"})";
+
+    JsonStringPool string_pool;
+    JsonReader reader{input, 0, &string_pool};
+    reader.read_value(config);
+
+    assert(config["region"_member].value == "us-east");
+    assert(config["region"_member].value.data() == config["/backup/region"_path].value.data());
+    assert(config["region"_member].value.data() < input.data() || config["region"_member].value.data() >= input.data() + input.size());
+    assert(config["port"_member].value == 2);
+    assert(string_pool.size() == 1);
+
+    auto escaped = R"({"name": ""})"_pooled_json;
+    JsonReader escaped_reader{R"({"name": "q\"uote"})", 0, &string_pool};
+    escaped_reader.read_value(escaped);
+    assert(escaped["name"_member].value == "q\"uote");
+}
+
+void test_read_without_string_pool()
+{
+    auto config = R"({"region": "eu-west"})"_pooled_json;
+    try
+    {
+        JsonReader reader{R"({"region": "us-east"})"};
+        reader.read_value(config);
+        assert(false);
+    }
+    catch (const JsonParseFailure &failure)
+    {
+        assert(failure.error == "Pooled string members can only be read with a string pool.");
+    }
+    assert(config["region"_member].value == "eu-west");
+
+    // Owning string members don't need a pool.
+    auto json = R"({"region": "eu-west"})"_json;
+    JsonReader reader{R"({"region": "us-east"})"};
+    reader.read_value(json);
+    assert(json["region"_member].value == "us-east");
+}
+
+int main()
+{
+    test_pooled_values();
+    test_literal_deduplication();
+    test_intern();
+    test_read_with_string_pool();
+    test_read_without_string_pool();
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include "compile_time_json/projection.hpp"
+#include "compile_time_json/tracked_json.hpp"
+
+#include <cassert>
+#include <string_view>
+#include <vector>
+
+auto json = R"({"a": [{"x": 1}, {"x": 2, "y": 3}, {"x": 4}, {"x": 5, "z": [6, 7]}], "b": {"c": true, "d": []}})"_json;
+
+std::vector<std::string_view> changed_paths(const auto &tracked)
+{
+    std::vector<std::string_view> paths;
+    tracked.for_each_changed([&](const JsonLeafDescriptor &leaf) { paths.push_back(leaf.path); });
+    return paths;
+}
+
+void test_dense_schema()
+{
+    TrackedJson<decltype(json)> tracked{json};
+    assert(changed_paths(tracked).empty());
+
+    tracked["/b/c"_path].value = false;
+    assert(tracked.changed<"/b">() && tracked.changed<"/b/c">() && !tracked.changed<"/b/d">() && !tracked.changed<"/a">());
+    assert(!tracked.get_value()["b"_member]["c"_member].value);
+    tracked.clear_dirty();
+
+    tracked["a"_member].get<1>()["y"_member].value = 1;
+    assert(changed_paths(tracked) == std::vector<std::string_view>{"/a/1/y"});
+    tracked.clear_dirty();
+
+    tracked["a"_member].get<3>()["z"_member][1].value = 8;
+    assert(changed_paths(tracked) == std::vector<std::string_view>{"/a/3/z/1"});
+    tracked.clear_dirty();
+
+    tracked["a"_member].get<3>().assign(json["a"_member].get<3>());
+    assert(changed_paths(tracked) == (std::vector<std::string_view>{"/a/3/x", "/a/3/z/0", "/a/3/z/1"}));
+}
+
+// Projections keep the indices of the selected elements, so the arrays of their types can be sparse.
+void test_sparse_array()
+{
+    auto projection = project<"/a/2"_path, "/a/3"_path>(json);
+    TrackedJson<decltype(projection)> tracked{projection};
+
+    tracked["/a/3"_path]["x"_member].value = 9;
+    assert(tracked.changed<"/a/3">() && tracked.changed<"/a/3/x">() && tracked.changed<"/a">());
+    assert(!tracked.changed<"/a/2">() && !tracked.changed<"/a/3/z">());
+    assert(changed_paths(tracked) == std::vector<std::string_view>{"/a/3/x"});
+    assert(tracked.get_value()["/a/3/x"_path].value == 9);
+    tracked.clear_dirty();
+
+    tracked["a"_member].get<2>()["x"_member].value = 10;
+    assert(changed_paths(tracked) == std::vector<std::string_view>{"/a/2/x"});
+    tracked.clear_dirty();
+
+    tracked["a"_member].get<3>()["z"_member][0].value = 11;
+    assert(tracked.changed<"/a/3/z/0">() && !tracked.changed<"/a/3/z/1">() && !tracked.changed<"/a/3/x">());
+    assert(changed_paths(tracked) == std::vector<std::string_view>{"/a/3/z/0"});
+}
+
+int main()
+{
+    test_dense_schema();
+    test_sparse_array();
+    return 0;
+}